@@ -9,12 +9,88 @@
 // Number of frames the AI "thinks" before selecting and playing its hand
 #define AI_THINK_DELAY_FRAMES 40
 
+// CPU cycles in one frame, 228 scanlines of 1232 cycles
+#define AI_FRAME_CYCLES 280896
+
+// CPU cycles the background search may use per frame during the think delay,
+// leaving the rest of the frame to the game loop
+#define AI_SEARCH_FRAME_BUDGET_CYCLES (AI_FRAME_CYCLES / 4)
+
+// Budget that runs the search to the end, see ai_search_step()
+#define AI_SEARCH_BUDGET_UNLIMITED 0xFFFFFFFFu
+
+// Number of best subsets of each size, by base score, that are rescored with
+// the owned jokers' effects before the AI picks one
+#define AI_JOKER_CANDIDATES_PER_SIZE 2
+
+// Refills sampled per discard candidate by the discard planner, more samples
+// make a stronger AI at the cost of CPU time, see ai_plan_discard()
+#define AI_PLANNER_DEFAULT_SAMPLES 16
+
+// Percentage by which the average refilled hand has to beat the hand played
+// now for the discard planner to discard, see ai_plan_discard()
+#define AI_PLANNER_MIN_GAIN_PERCENT 75
+
+// CPU cycles the AI's opening hand may be walked with per idle frame of the
+// player's turn, kept low since the player may be animating, see
+// ai_precompute_step()
+#define AI_PRECOMPUTE_FRAME_BUDGET_CYCLES (AI_FRAME_CYCLES / 8)
+
+/**
+ * @brief AI difficulty levels, picked on the main menu
+ */
+enum AILevel
+{
+    AI_LEVEL_GREEDY,      // Base hand score only, discards below fixed hand types
+    AI_LEVEL_JOKER_AWARE, // Rescores the best hands with the owned jokers
+    AI_LEVEL_PLANNER,     // Joker-aware, and plans discards by sampling the deck
+    AI_NUM_LEVELS
+};
+
+/**
+ * @brief What one AI difficulty level is allowed to do
+ */
+typedef struct
+{
+    // Name shown on the main menu
+    const char* name;
+    // CPU cycles one decision may take in total, across every frame it is
+    // spread over. The hand search spends them first, the best hand found so
+    // far is played once they run out, and the discard decision the rest
+    u32 decision_budget_cycles;
+    // Largest number of cards the search tries to play together
+    int search_depth;
+    // Whether the best hands are rescored with the owned jokers' effects
+    bool joker_aware;
+    // Refills sampled per discard candidate, 0 discards below fixed hand types
+    int planner_samples;
+} AILevelInfo;
+
+/**
+ * @brief Sets the difficulty level used by the next searches and discards.
+ *
+ * Out of range levels fall back to AI_LEVEL_GREEDY. A search already started
+ * keeps the level it was started with.
+ */
+void ai_set_level(enum AILevel level);
+
+/**
+ * @brief Returns the current difficulty level, AI_LEVEL_GREEDY by default.
+ */
+enum AILevel ai_get_level(void);
+
+/**
+ * @brief Returns the description of a difficulty level, NULL if out of range.
+ */
+const AILevelInfo* ai_get_level_info(enum AILevel level);
+
 /**
  * @brief Selects the best subset of cards (1–5 cards) for the AI to play.
  *
  * Evaluates all non-empty subsets of the given hand (up to MAX_SELECTION_SIZE),
- * estimates the score for each subset (hand type × joker bonuses), and marks
- * the highest-scoring subset in out_sel.
+ * estimates the score for each subset from its hand type and card chips,
+ * rescores the best ones of each size with the owned jokers' effects if any,
+ * and marks the highest-scoring subset in out_sel.
  *
  * @param hand           Array of Card* representing the AI's current hand.
  * @param count          Number of cards available (>= 0).
@@ -27,4 +103,183 @@
 int ai_select_best_hand(Card** hand, int count, bool* out_sel,
                         enum HandType* out_hand_type);
 
+/**
+ * @brief Starts a background search for the best subset of cards.
+ *
+ * Same search as ai_select_best_hand(), but walked a slice at a time by
+ * ai_search_step() so it can run during the think delay without taking a
+ * whole frame. The cards and the current rule set are copied, so hand may be
+ * reused once this returns. Starting a new search drops the previous one.
+ *
+ * @param hand   Array of Card* representing the AI's current hand.
+ * @param count  Number of cards available (>= 0).
+ */
+void ai_search_begin(Card** hand, int count);
+
+/**
+ * @brief Continues the background search for at most budget_cycles.
+ *
+ * Time is measured with hardware timers 2 and 3 cascaded, the budget may be
+ * overrun by a single subset evaluation. Once the level's decision budget is
+ * spent the search stops with the best hand found so far.
+ *
+ * @param budget_cycles  CPU cycles to spend, or AI_SEARCH_BUDGET_UNLIMITED.
+ * @return               true once every subset has been considered.
+ */
+bool ai_search_step(u32 budget_cycles);
+
+/**
+ * @brief Drops every cached subset score.
+ *
+ * The search keeps the base score and hand type of the subsets it visits
+ * across decisions, so a hand that is mostly unchanged after a discard is
+ * mostly looked up. Must be called whenever the owned jokers change.
+ */
+void ai_score_cache_clear(void);
+
+/**
+ * @brief Walks the subsets of a hand the AI is going to be dealt, ahead of time.
+ *
+ * Meant for the AI's opening hand, which is known as soon as its deck is
+ * shuffled, so the walk can run during idle frames of the player's turn.
+ * A later ai_search_begin() on the same cards, in the same order and under
+ * the same level and rules, picks up the walk instead of starting over and
+ * only redoes the joker rescoring. The cards are copied.
+ *
+ * @param hand   Array of Card* the AI is going to be dealt.
+ * @param count  Number of cards (>= 0).
+ */
+void ai_precompute_begin(Card** hand, int count);
+
+/**
+ * @brief Continues the walk started by ai_precompute_begin().
+ *
+ * @param budget_cycles  CPU cycles to spend, or AI_SEARCH_BUDGET_UNLIMITED.
+ * @return               true once the walk is done, or if none was started.
+ */
+bool ai_precompute_step(u32 budget_cycles);
+
+/**
+ * @brief Drops the walk started by ai_precompute_begin(), if any.
+ */
+void ai_precompute_clear(void);
+
+/**
+ * @brief Completes the background search and returns its result.
+ *
+ * Same outputs as ai_select_best_hand(), out_sel is indexed like the hand
+ * given to ai_search_begin(). Returns immediately if ai_search_step() already
+ * reported the search as done.
+ */
+int ai_search_finish(bool* out_sel, enum HandType* out_hand_type);
+
+/**
+ * @brief Picks the cards to discard by sampling refills from the remaining deck.
+ *
+ * A few discards are derived from the hand (the leftovers of best_sel, and
+ * keeping the largest N of a kind, the largest suit or the best straight
+ * window). For each, random refills are drawn from deck and scored like the
+ * hand search would play them, best subset with its card chips and the owned
+ * jokers. The discard with the best average wins if it beats the hand as it
+ * is by AI_PLANNER_MIN_GAIN_PERCENT. Draws use a local PRNG, never rand().
+ *
+ * Runs the whole decision at once, see ai_discard_begin() for one spread
+ * over frames.
+ *
+ * @param hand           Array of Card* representing the AI's current hand.
+ * @param count          Number of cards available (>= 0).
+ * @param best_sel       The selection the AI would play now, see
+ *                       ai_select_best_hand().
+ * @param deck           The cards that can still be drawn.
+ * @param deck_count     Number of entries in deck.
+ * @param remaining      Composition of deck, used to skip flush and straight
+ *                       draws it can no longer complete. Can be NULL.
+ * @param samples        Refills drawn per discard, the strength knob.
+ * @param budget_cycles  CPU cycles to spend, or AI_SEARCH_BUDGET_UNLIMITED.
+ *                       Sampling stops early once it runs out, the refill
+ *                       being scored then is dropped.
+ * @param out_discard    Output boolean array (same size as hand), true for
+ *                       the cards to discard.
+ * @return               Number of cards to discard, at most
+ *                       MAX_SELECTION_SIZE, or 0 to play best_sel instead.
+ */
+int ai_plan_discard(Card** hand, int count, const bool* best_sel,
+                    Card** deck, int deck_count,
+                    const DeckComposition* remaining, int samples,
+                    u32 budget_cycles, bool* out_discard);
+
+/**
+ * @brief Reseeds the PRNG the discard planner draws refills with.
+ *
+ * The sequence is otherwise carried over from one decision to the next,
+ * reseeding makes a run reproducible. A seed of 0 restores the initial one.
+ */
+void ai_planner_seed(u32 seed);
+
+/**
+ * @brief Starts deciding which cards to discard, the way the current level does.
+ *
+ * Levels that sample refills go through the same sampling as
+ * ai_plan_discard(), walked a search step at a time by ai_discard_step() so
+ * it can be spread over frames. It spends what the last hand search returned
+ * by ai_search_finish() or ai_select_best_hand() left of the level's
+ * decision budget. The others decide right away: every card left out of
+ * best_sel (at most MAX_SELECTION_SIZE) goes when best_hand_type is below a
+ * straight, or below two pair after the first discard. The cards and the
+ * deck are copied, so they may be reused once this returns. Starting a new
+ * decision drops the previous one.
+ *
+ * @param hand            Array of Card* representing the AI's current hand.
+ * @param count           Number of cards available (>= 0).
+ * @param best_sel        The selection the AI would play now.
+ * @param best_hand_type  The hand type of best_sel.
+ * @param discards_taken  Discards already made since the last played hand.
+ * @param deck            The cards that can still be drawn.
+ * @param deck_count      Number of entries in deck.
+ * @param remaining       Composition of deck, see ai_plan_discard().
+ */
+void ai_discard_begin(Card** hand, int count, const bool* best_sel,
+                      enum HandType best_hand_type, int discards_taken,
+                      Card** deck, int deck_count,
+                      const DeckComposition* remaining);
+
+/**
+ * @brief Continues the discard decision for at most budget_cycles.
+ *
+ * Timed like ai_search_step(), the budget may be overrun by a single step of
+ * the search scoring a refill. Once the level's decision budget is spent the
+ * decision is made from the refills scored so far.
+ *
+ * @param budget_cycles  CPU cycles to spend, or AI_SEARCH_BUDGET_UNLIMITED.
+ * @return               true once the decision is made.
+ */
+bool ai_discard_step(u32 budget_cycles);
+
+/**
+ * @brief Completes the discard decision and returns it.
+ *
+ * Returns immediately if ai_discard_step() already reported the decision as
+ * made.
+ *
+ * @param out_discard  Output boolean array (same size as the hand given to
+ *                     ai_discard_begin()), true for the cards to discard.
+ * @return             Number of cards to discard, or 0 to play best_sel.
+ */
+int ai_discard_finish(bool* out_discard);
+
+/**
+ * @brief Picks the cards to discard the way the current level does, at once.
+ *
+ * Same as ai_discard_begin() followed by ai_discard_finish(), and with the
+ * same parameters.
+ *
+ * @param out_discard     Output boolean array (same size as hand), true for
+ *                        the cards to discard.
+ * @return                Number of cards to discard, or 0 to play best_sel.
+ */
+int ai_choose_discard(Card** hand, int count, const bool* best_sel,
+                      enum HandType best_hand_type, int discards_taken,
+                      Card** deck, int deck_count,
+                      const DeckComposition* remaining, bool* out_discard);
+
 #endif // AI_PLAYER_H
@@ -1,6 +1,7 @@
 #ifndef CARD_H
 #define CARD_H
 
+#include "card_types.h"
 #include "sprite.h"
 
 #include <maxmod.h>
@@ -14,39 +15,9 @@
 #define CARD_PB             0
 #define CARD_STARTING_LAYER 0
 
-// Card suits
-#define DIAMONDS  0
-#define CLUBS     1
-#define HEARTS    2
-#define SPADES    3
-#define NUM_SUITS 4
-
-// Card ranks
-#define TWO         0
-#define THREE       1
-#define FOUR        2
-#define FIVE        3
-#define SIX         4
-#define SEVEN       5
-#define EIGHT       6
-#define NINE        7
-#define TEN         8
-#define JACK        9
-#define QUEEN       10
-#define KING        11
-#define ACE         12
-#define NUM_RANKS   13
-#define RANK_OFFSET 2 // Because the first rank is 2 and ranks start at 0
-
 #define IMPOSSIBLY_HIGH_CARD_VALUE 100
 
 // Card types
-typedef struct Card
-{
-    u8 suit;
-    u8 rank;
-} Card;
-
 typedef struct CardObject
 {
     Card* card;
@@ -0,0 +1,43 @@
+/**
+ * @file card_types.h
+ *
+ * @brief Card suits, ranks and the Card type, kept free of tonc so they can be used by host-side
+ * tests
+ */
+#ifndef CARD_TYPES_H
+#define CARD_TYPES_H
+
+#include <stdint.h>
+
+// Card suits
+#define DIAMONDS  0
+#define CLUBS     1
+#define HEARTS    2
+#define SPADES    3
+#define NUM_SUITS 4
+
+// Card ranks
+#define TWO         0
+#define THREE       1
+#define FOUR        2
+#define FIVE        3
+#define SIX         4
+#define SEVEN       5
+#define EIGHT       6
+#define NINE        7
+#define TEN         8
+#define JACK        9
+#define QUEEN       10
+#define KING        11
+#define ACE         12
+#define NUM_RANKS   13
+#define RANK_OFFSET 2 // Because the first rank is 2 and ranks start at 0
+
+// Card types
+typedef struct Card
+{
+    uint8_t suit;
+    uint8_t rank;
+} Card;
+
+#endif // CARD_TYPES_H
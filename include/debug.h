@@ -12,6 +12,7 @@
  *   SELECT + A     : Add $100 to current money
  *   SELECT + DOWN  : Instantly win current round (set score to requirement)
  *   SELECT + L     : Add +1 hand and +1 discard
+ *   SELECT + R     : Reset the hand memo hit/miss counters (shown in the joker picker)
  *
  * Compile-time only (edit debug.h):
  *   DEBUG_FORCE_JOKER_ID : Force-add a joker at round start
@@ -0,0 +1,130 @@
+/**
+ * @file deck_composition.h
+ *
+ * @brief Live composition of a pile of cards, kept in sync as cards come and go
+ *
+ * Deck Composition
+ * ================
+ *
+ *  - Holds how many copies of each card, rank and suit a pile contains, plus the per-suit rank
+ * masks of the cards present, so questions like "how many hearts are left to draw" are answered
+ * in constant time instead of scanning the pile.
+ *
+ *  - Counts are exact, duplicated cards included. A suit's rank bit is only cleared once its last
+ * copy is removed.
+ */
+#ifndef DECK_COMPOSITION_H
+#define DECK_COMPOSITION_H
+
+#include "card_types.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @brief Card counts of a pile, see the file documentation
+ */
+typedef struct DeckComposition
+{
+    uint8_t card_counts[NUM_SUITS][NUM_RANKS]; // Copies of each card
+    uint16_t suit_ranks[NUM_SUITS];            // Bit r set if that suit has a card of rank r
+    uint8_t rank_counts[NUM_RANKS];            // Cards of each rank, any suit
+    uint8_t suit_counts[NUM_SUITS];            // Cards of each suit, any rank
+    uint8_t size;                              // Cards in the pile
+} DeckComposition;
+
+/**
+ * @brief Empties a composition
+ */
+static inline void deck_comp_clear(DeckComposition* comp)
+{
+    *comp = (DeckComposition){0};
+}
+
+/**
+ * @brief Adds a card to a composition
+ * @param comp the composition to update
+ * @param card the card to add, must not be NULL
+ */
+static inline void deck_comp_add(DeckComposition* comp, const Card* card)
+{
+    comp->card_counts[card->suit][card->rank]++;
+    comp->suit_ranks[card->suit] |= 1 << card->rank;
+    comp->rank_counts[card->rank]++;
+    comp->suit_counts[card->suit]++;
+    comp->size++;
+}
+
+/**
+ * @brief Removes a card from a composition, does nothing if the card isn't in it
+ * @param comp the composition to update
+ * @param card the card to remove, must not be NULL
+ */
+static inline void deck_comp_remove(DeckComposition* comp, const Card* card)
+{
+    uint8_t* count = &comp->card_counts[card->suit][card->rank];
+    if (*count == 0)
+        return;
+
+    if (--*count == 0)
+        comp->suit_ranks[card->suit] &= ~(1 << card->rank);
+    comp->rank_counts[card->rank]--;
+    comp->suit_counts[card->suit]--;
+    comp->size--;
+}
+
+/**
+ * @brief Rebuilds a composition from an explicit array of cards, NULL entries are skipped
+ * @param comp output - the composition to fill
+ * @param cards array of cards
+ * @param count number of entries in cards
+ */
+static inline void deck_comp_from_cards(DeckComposition* comp, Card* const* cards, int count)
+{
+    deck_comp_clear(comp);
+    for (int i = 0; i < count; i++)
+    {
+        if (cards[i] != NULL)
+            deck_comp_add(comp, cards[i]);
+    }
+}
+
+/**
+ * @brief Returns the number of copies of a card in the composition
+ */
+static inline uint8_t deck_comp_card_count(const DeckComposition* comp, uint8_t suit, uint8_t rank)
+{
+    return comp->card_counts[suit][rank];
+}
+
+/**
+ * @brief Returns the number of cards of a rank in the composition
+ */
+static inline uint8_t deck_comp_rank_count(const DeckComposition* comp, uint8_t rank)
+{
+    return comp->rank_counts[rank];
+}
+
+/**
+ * @brief Returns the number of cards of a suit in the composition
+ */
+static inline uint8_t deck_comp_suit_count(const DeckComposition* comp, uint8_t suit)
+{
+    return comp->suit_counts[suit];
+}
+
+/**
+ * @brief Returns the rank mask (bit TWO to bit ACE) of the ranks with at least one card
+ */
+static inline uint16_t deck_comp_rank_mask(const DeckComposition* comp)
+{
+    uint16_t rank_mask = 0;
+    for (int suit = 0; suit < NUM_SUITS; suit++)
+    {
+        rank_mask |= comp->suit_ranks[suit];
+    }
+    return rank_mask;
+}
+
+#endif // DECK_COMPOSITION_H
@@ -0,0 +1,20 @@
+// clang-format off
+// (name, four_fingers, shortcut, smeared, mobius_wrap)
+// Ordered so that the row index matches HAND_EVAL_VARIANT_IDX()
+DEF_HAND_EVAL_VARIANT(vanilla,              false, false, false, false)
+DEF_HAND_EVAL_VARIANT(ff,                   true,  false, false, false)
+DEF_HAND_EVAL_VARIANT(sc,                   false, true,  false, false)
+DEF_HAND_EVAL_VARIANT(ff_sc,                true,  true,  false, false)
+DEF_HAND_EVAL_VARIANT(smeared,              false, false, true,  false)
+DEF_HAND_EVAL_VARIANT(ff_smeared,           true,  false, true,  false)
+DEF_HAND_EVAL_VARIANT(sc_smeared,           false, true,  true,  false)
+DEF_HAND_EVAL_VARIANT(ff_sc_smeared,        true,  true,  true,  false)
+DEF_HAND_EVAL_VARIANT(mobius,               false, false, false, true)
+DEF_HAND_EVAL_VARIANT(ff_mobius,            true,  false, false, true)
+DEF_HAND_EVAL_VARIANT(sc_mobius,            false, true,  false, true)
+DEF_HAND_EVAL_VARIANT(ff_sc_mobius,         true,  true,  false, true)
+DEF_HAND_EVAL_VARIANT(smeared_mobius,       false, false, true,  true)
+DEF_HAND_EVAL_VARIANT(ff_smeared_mobius,    true,  false, true,  true)
+DEF_HAND_EVAL_VARIANT(sc_smeared_mobius,    false, true,  true,  true)
+DEF_HAND_EVAL_VARIANT(ff_sc_smeared_mobius, true,  true,  true,  true)
+// clang-format on
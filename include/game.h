@@ -1,6 +1,10 @@
 #ifndef GAME_H
 #define GAME_H
 
+#include "deck_composition.h"
+#include "hand_eval.h"
+#include "hand_type.h"
+
 #include <tonc.h>
 
 #define MAX_HAND_SIZE        16
@@ -82,53 +86,6 @@ enum PlayState
     PLAY_ENDED
 };
 
-// Hand types
-enum HandType
-{
-    NONE,
-    HIGH_CARD,
-    PAIR,
-    TWO_PAIR,
-    THREE_OF_A_KIND,
-    STRAIGHT,
-    FLUSH,
-    FULL_HOUSE,
-    FOUR_OF_A_KIND,
-    STRAIGHT_FLUSH,
-    ROYAL_FLUSH,
-    FIVE_OF_A_KIND,
-    FLUSH_HOUSE,
-    FLUSH_FIVE
-};
-
-// clang-format off
-// Store all contained hands to optimize "whole hand condition" Jokers
-typedef struct ContainedHandTypes
-{
-    union
-    {
-        struct
-        {
-            u16 HIGH_CARD : 1;
-            u16 PAIR : 1;
-            u16 TWO_PAIR : 1;
-            u16 THREE_OF_A_KIND : 1;
-            u16 STRAIGHT : 1;
-            u16 FLUSH : 1;
-            u16 FULL_HOUSE : 1;
-            u16 FOUR_OF_A_KIND : 1;
-            u16 STRAIGHT_FLUSH : 1;
-            u16 ROYAL_FLUSH : 1;
-            u16 FIVE_OF_A_KIND : 1;
-            u16 FLUSH_HOUSE : 1;
-            u16 FLUSH_FIVE : 1;
-            u16 : 3;
-        };
-        u16 value;
-    };
-} ContainedHandTypes;
-// clang-format on
-
 typedef struct
 {
     int substate;
@@ -149,6 +106,8 @@ CardObject** get_played_array(void);
 int get_played_top(void);
 int get_scored_card_index(void);
 bool is_joker_owned(int joker_id);
+// Number of copies of a joker ID among the owned jokers, for effects that stack
+int count_jokers_owned(int joker_id);
 bool card_is_face(Card* card);
 List* get_jokers_list(void);
 List* get_expired_jokers_list(void);
@@ -156,6 +115,37 @@ List* get_expired_jokers_list(void);
 ContainedHandTypes* get_contained_hands(void);
 enum HandType* get_hand_type(void);
 
+/**
+ * @brief A hand that is scored without being played, used to run joker effects speculatively.
+ *
+ * While a preview is set, get_contained_hands(), get_hand_type(), get_played_top(),
+ * get_scored_card_index(), get_hand_array(), get_hand_top(), hand_get_size(), get_chips() and
+ * get_mult() read from it instead of the played hand, so joker effects see the previewed hand and
+ * its scratch chips and mult.
+ */
+typedef struct ScorePreview
+{
+    ContainedHandTypes contained_hands;
+    enum HandType hand_type;
+    int played_top;        // Index of the last previewed played card
+    CardObject** held;     // Cards left in hand while the previewed hand scores
+    int held_top;          // Index of the last held card
+    int scored_card_index; // Played or held card being scored, same as during real scoring
+    u32 chips;
+    u32 mult;
+} ScorePreview;
+
+/**
+ * @brief Starts or ends a score preview
+ * @param preview the hand the scoring getters report from now on, NULL to end the preview
+ */
+void game_set_score_preview(ScorePreview* preview);
+
+/**
+ * @brief Returns true while a score preview is set, see game_set_score_preview()
+ */
+bool game_is_score_preview(void);
+
 int get_deck_top(void);
 int get_num_discards_remaining(void);
 int get_num_hands_remaining(void);
@@ -178,7 +168,15 @@ int get_game_speed(void);
 void set_game_speed(int new_game_speed);
 
 // joker specific functions
+void add_owned_joker(JokerObject* joker_object);
+const RuleSet* get_rule_set(void);
+
+/**
+ * @brief Returns the live composition of the cards left to draw
+ */
+const DeckComposition* get_deck_composition(void);
 bool is_shortcut_joker_active(void);
+bool is_four_fingers_joker_active(void);
 int get_straight_and_flush_size(void);
 
 #endif // GAME_H
@@ -0,0 +1,64 @@
+/**
+ * @file hand_class_lut.h
+ *
+ * @brief Precomputed hand classification table for hands evaluated without rule-bending jokers
+ *
+ * The table itself is generated at build time by scripts/generate_hand_class_lut.py.
+ */
+#ifndef HAND_CLASS_LUT_H
+#define HAND_CLASS_LUT_H
+
+#include "card_types.h"
+
+#include <stdint.h>
+
+/**
+ * @def HAND_CLASS_MAX_CARDS
+ * @brief Largest number of cards the table classifies
+ */
+#define HAND_CLASS_MAX_CARDS 5
+
+/**
+ * @def HAND_CLASS_LUT_SIZE
+ * @brief Number of entries in the table, one per multiset of 1 to HAND_CLASS_MAX_CARDS ranks
+ */
+#define HAND_CLASS_LUT_SIZE 8567
+
+/**
+ * @def HAND_CLASS_TYPE_MASK
+ * @brief Bits of an entry holding the hand type of the ranks
+ */
+#define HAND_CLASS_TYPE_MASK 0xF
+
+/**
+ * @def HAND_CLASS_FLUSH_TYPE_SHIFT
+ * @brief Shift of the hand type of the ranks when all HAND_CLASS_MAX_CARDS cards share a suit
+ */
+#define HAND_CLASS_FLUSH_TYPE_SHIFT 4
+
+/**
+ * @def HAND_CLASS_SCORING_RANKS_SHIFT
+ * @brief Shift of the 13-bit mask of the ranks that score for the non-flush hand type
+ */
+#define HAND_CLASS_SCORING_RANKS_SHIFT 16
+
+/**
+ * @brief Key weight of a card by its position in the sorted multiset and its rank.
+ *
+ * The key of a multiset of `k` ranks sorted in ascending order is
+ * `hand_class_size_offsets[k]` plus the sum of `hand_class_key_weights[i][rank_i]`, which is a
+ * minimal perfect hash of the multiset into hand_class_lut.
+ */
+extern const uint16_t hand_class_key_weights[HAND_CLASS_MAX_CARDS][NUM_RANKS];
+
+/**
+ * @brief First key of the multisets of each size, see hand_class_key_weights
+ */
+extern const uint16_t hand_class_size_offsets[HAND_CLASS_MAX_CARDS + 1];
+
+/**
+ * @brief Hand classification table indexed by multiset key, see the `HAND_CLASS_*` entry layout
+ */
+extern const uint32_t hand_class_lut[HAND_CLASS_LUT_SIZE];
+
+#endif // HAND_CLASS_LUT_H
@@ -0,0 +1,296 @@
+/**
+ * @file hand_eval.h
+ *
+ * @brief Hand type evaluation shared by the game and the AI
+ *
+ * Hand Evaluation
+ * ===============
+ *
+ *  - The evaluator works on a @ref HandBitboard built from an explicit set of cards and a
+ * @ref RuleSet describing the jokers that bend the poker rules. It does not read any game state
+ * so the same code path serves the player's selection, the AI search and host-side tests.
+ */
+#ifndef HAND_EVAL_H
+#define HAND_EVAL_H
+
+#include "card_types.h"
+#include "hand_type.h"
+#include "rank_histogram.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define STRAIGHT_AND_FLUSH_SIZE_FOUR_FINGERS 4
+#define STRAIGHT_AND_FLUSH_SIZE_DEFAULT      5
+
+/**
+ * @def ROYAL_RANK_MASK
+ * @brief Rank mask of the cards needed for a royal flush
+ */
+#define ROYAL_RANK_MASK ((1 << TEN) | (1 << JACK) | (1 << QUEEN) | (1 << KING) | (1 << ACE))
+
+/**
+ * @def FACE_RANK_MASK
+ * @brief Rank mask of the regular face cards
+ */
+#define FACE_RANK_MASK ((1 << JACK) | (1 << QUEEN) | (1 << KING))
+
+/**
+ * @def ALL_RANKS_MASK
+ * @brief Rank mask with every rank set
+ */
+#define ALL_RANKS_MASK ((1 << NUM_RANKS) - 1)
+
+/**
+ * @brief Joker driven rules that change how cards and poker hands are evaluated.
+ *
+ * The game keeps one of these cached and only rebuilds it when the owned jokers change,
+ * see get_rule_set().
+ */
+typedef struct RuleSet
+{
+    /**
+     * @brief Number of cards needed for a straight or a flush, 4 with Four Fingers, 5 otherwise
+     */
+    uint8_t straight_size;
+
+    /**
+     * @brief Shortcut: straights may skip one rank between two cards
+     */
+    bool shortcut;
+
+    /**
+     * @brief Smeared Joker: hearts/diamonds and spades/clubs count as the same suit for flushes
+     */
+    bool smeared;
+
+    /**
+     * @brief Mobius: straights may wrap from Ace back to Two
+     */
+    bool mobius_wrap;
+
+    /**
+     * @brief Joker 60: legacy wrap-around streak check, see STRAIGHT_LUT_LEGACY_WRAP
+     */
+    bool legacy_wrap;
+
+    /**
+     * @brief Pareidolia: every card is considered a face card
+     */
+    bool pareidolia;
+
+    /**
+     * @brief Ranks considered face cards, FACE_RANK_MASK unless a joker overrides it
+     */
+    uint16_t face_rank_mask;
+} RuleSet;
+
+/**
+ * @brief Returns true if a card counts as a face card under the given rules
+ */
+static inline bool rule_set_card_is_face(const RuleSet* rules, const Card* card)
+{
+    return (rules->face_rank_mask >> card->rank) & 0x1;
+}
+
+/**
+ * @brief Returns true if no joker changes how poker hands are evaluated.
+ *
+ * Under these rules hands of up to five cards can be classified with a single table lookup,
+ * see hand_eval_vanilla_type().
+ */
+static inline bool rule_set_is_vanilla(const RuleSet* rules)
+{
+    return rules->straight_size == STRAIGHT_AND_FLUSH_SIZE_DEFAULT && !rules->shortcut &&
+           !rules->smeared && !rules->mobius_wrap && !rules->legacy_wrap;
+}
+
+/**
+ * @brief Bitboard view of a set of cards used by the hand type predicates.
+ *
+ * Rank bits are indexed by the rank defines in card_types.h (bit TWO to bit ACE), so a 13-bit
+ * mask fits a uint16_t. Per-rank counts are a @ref RankHistogram, which saturates at 7, more than
+ * any N-of-a-kind check needs. Per-suit counts are packed as one byte per suit in a uint32_t so
+ * that duplicated cards still count towards a flush.
+ */
+typedef struct HandBitboard
+{
+    uint16_t suit_ranks[NUM_SUITS]; // suit_ranks[suit] has bit r set if a card of rank r is present
+    uint16_t rank_mask;             // Union of suit_ranks[]
+    uint32_t suit_counts;           // Byte `suit` holds the number of cards of that suit
+    RankHistogram rank_counts;      // Nibble `rank` holds the number of cards of that rank
+} HandBitboard;
+
+/**
+ * @brief Empties a bitboard
+ * @param bb the bitboard to clear
+ */
+void hand_bitboard_clear(HandBitboard* bb);
+
+/**
+ * @brief Adds a single card to a bitboard
+ * @param bb the bitboard to update
+ * @param card the card to add, must not be NULL
+ */
+void hand_bitboard_add_card(HandBitboard* bb, const Card* card);
+
+/**
+ * @brief Removes a single card previously added to a bitboard
+ *
+ * Exact as long as no rank held more than 7 cards and the card was unique in the bitboard, which
+ * always holds for a selection of at most MAX_SELECTION_SIZE cards from a regular deck.
+ *
+ * @param bb the bitboard to update
+ * @param card the card to remove, must not be NULL
+ */
+void hand_bitboard_remove_card(HandBitboard* bb, const Card* card);
+
+/**
+ * @brief Adds every card of another bitboard to a bitboard
+ * @param bb the bitboard to update
+ * @param other the cards to add
+ */
+void hand_bitboard_merge(HandBitboard* bb, const HandBitboard* other);
+
+/**
+ * @brief Builds a bitboard from an explicit array of cards, NULL entries are skipped
+ * @param bb_out output - the bitboard to fill
+ * @param cards array of cards
+ * @param count number of entries in cards
+ */
+void hand_bitboard_from_cards(HandBitboard* bb_out, Card** cards, int count);
+
+/**
+ * @brief Returns the number of cards of the given suit in the bitboard
+ */
+static inline uint8_t hand_bitboard_suit_count(const HandBitboard* bb, uint8_t suit)
+{
+    return (bb->suit_counts >> (suit * 8)) & 0xFF;
+}
+
+uint8_t hand_contains_n_of_a_kind(const HandBitboard* bb);
+bool hand_contains_two_pair(const HandBitboard* bb);
+bool hand_contains_full_house(const HandBitboard* bb);
+bool hand_contains_straight(const HandBitboard* bb, const RuleSet* rules);
+bool hand_contains_flush(const HandBitboard* bb, const RuleSet* rules);
+
+/**
+ * @brief A hand evaluator, see hand_eval_contained_types()
+ */
+typedef ContainedHandTypes (*HandEvalFunc)(const HandBitboard* bb, const RuleSet* rules);
+
+/**
+ * @def HAND_EVAL_VARIANT_IDX
+ * @brief Index of the specialized evaluator for a combination of rule bits
+ */
+#define HAND_EVAL_VARIANT_IDX(four_fingers, shortcut, smeared, mobius_wrap)                      \
+    (((four_fingers) ? 0x1 : 0) | ((shortcut) ? 0x2 : 0) | ((smeared) ? 0x4 : 0) |              \
+     ((mobius_wrap) ? 0x8 : 0))
+
+/**
+ * @def HAND_EVAL_NUM_VARIANTS
+ * @brief Number of specialized evaluators, one per combination of the rule bits above
+ */
+#define HAND_EVAL_NUM_VARIANTS 16
+
+/**
+ * @brief Returns the evaluator specialized for a rule set.
+ *
+ * One evaluator is generated per combination of Four Fingers, Shortcut, Smeared and Mobius
+ * (see def_hand_eval_variants.h) with those rules folded in at compile time. The remaining rules
+ * are still read from the RuleSet passed to the evaluator. Callers evaluating many hands under the
+ * same rules should select the variant once and call it directly.
+ *
+ * @param rules the rules to specialize for
+ * @return the evaluator, never NULL
+ */
+HandEvalFunc hand_eval_select_variant(const RuleSet* rules);
+
+/**
+ * @brief Computes every poker hand contained in a set of cards
+ * @param bb bitboard of the cards, an empty bitboard contains no hands
+ * @param rules the rules to evaluate with
+ * @return the contained hand types
+ */
+ContainedHandTypes hand_eval_contained_types(const HandBitboard* bb, const RuleSet* rules);
+
+/**
+ * @brief Computes every poker hand contained in an explicit array of cards
+ * @param cards array of cards, NULL entries are skipped
+ * @param count number of entries in cards
+ * @param rules the rules to evaluate with
+ * @return the contained hand types
+ */
+ContainedHandTypes hand_eval_cards(Card** cards, int count, const RuleSet* rules);
+
+/**
+ * @brief Base chips and mult of a hand type, before any card or joker is scored
+ */
+typedef struct HandValues
+{
+    uint32_t chips;
+    uint32_t mult;
+    const char* display_name;
+} HandValues;
+
+/**
+ * @brief Returns the base values of a hand type
+ *
+ * The game's scoring and the AI's estimates both read this one table so a balance change
+ * can't leave them out of sync.
+ *
+ * @param hand_type the hand type, NONE has 0 chips and 0 mult
+ * @return the base values of the hand type
+ */
+const HandValues* hand_eval_base_values(enum HandType hand_type);
+
+/**
+ * @brief Returns the most powerful hand type in a set of contained hand types
+ * @param contained_types the contained hand types
+ * @return the highest hand type, or NONE if no hand is contained
+ */
+enum HandType hand_eval_highest_type(ContainedHandTypes contained_types);
+
+/**
+ * @brief Computes which cards of a played hand score for its hand type.
+ *
+ * The scoring ranks and suits are derived from the bitboard masks, so the cards are only walked
+ * once to turn them into a mask. With Four Fingers, cards sharing a rank with a card of the
+ * straight also score.
+ *
+ * @param bb bitboard of the cards
+ * @param cards array of cards the bitboard was built from, NULL entries never score
+ * @param count number of entries in cards, at most 8
+ * @param hand_type the hand type the cards were played as
+ * @param rules the rules the hand type was evaluated with
+ * @return a mask with bit i set if cards[i] scores
+ */
+uint8_t hand_eval_scoring_mask(
+    const HandBitboard* bb,
+    Card** cards,
+    int count,
+    enum HandType hand_type,
+    const RuleSet* rules
+);
+
+/**
+ * @brief Returns the most powerful hand type of at most five cards under vanilla rules.
+ *
+ * A constant time lookup in the generated hand class table (see hand_class_lut.h) that gives
+ * the same result as hand_eval_highest_type() when rule_set_is_vanilla() holds.
+ *
+ * @param bb bitboard of at most HAND_CLASS_MAX_CARDS cards
+ * @return the highest hand type, or NONE if the bitboard is empty
+ */
+enum HandType hand_eval_vanilla_type(const HandBitboard* bb);
+
+/**
+ * @brief Table driven equivalent of hand_eval_scoring_mask() under vanilla rules
+ * @param bb bitboard of at most HAND_CLASS_MAX_CARDS cards
+ * @param cards array of cards the bitboard was built from, NULL entries never score
+ * @param count number of entries in cards
+ * @return a mask with bit i set if cards[i] scores
+ */
+uint8_t hand_eval_vanilla_scoring_mask(const HandBitboard* bb, Card** cards, int count);
+
+#endif // HAND_EVAL_H
@@ -0,0 +1,70 @@
+/**
+ * @file hand_memo.h
+ *
+ * @brief Small direct-mapped cache of hand evaluation results
+ *
+ * Hand Memo
+ * =========
+ *
+ *  - Results are keyed by the set of cards, one bit per suit and rank (52 bits), plus the rule
+ * bits that change how hands are evaluated, so owning or selling a joker never needs an explicit
+ * invalidation. The cache is meant to catch the player toggling the same card back and forth and
+ * the AI search revisiting the same card sets.
+ *
+ *  - Sets holding the same card more than once can't be told apart from the 52-bit key, they are
+ * always evaluated and never cached.
+ */
+#ifndef HAND_MEMO_H
+#define HAND_MEMO_H
+
+#include "hand_eval.h"
+
+#include <stdint.h>
+
+/**
+ * @def HAND_MEMO_NUM_ENTRIES
+ * @brief Number of cache entries, a power of two
+ */
+#define HAND_MEMO_NUM_ENTRIES 64
+
+/**
+ * @brief Cache hit and miss counters, shown by the debug overlay
+ */
+typedef struct HandMemoStats
+{
+    uint32_t hits;
+    uint32_t misses;
+} HandMemoStats;
+
+/**
+ * @brief Evaluates a set of cards, reusing the cached result if the same set was seen before
+ *
+ * @param bb bitboard of the cards
+ * @param rules the rules to evaluate with
+ * @param hand_eval the evaluator for these rules, see hand_eval_select_variant()
+ * @param out_hand_type output - the highest hand type of the cards, can be NULL
+ * @return the contained hand types, same as `hand_eval(bb, rules)`
+ */
+ContainedHandTypes hand_memo_eval(
+    const HandBitboard* bb,
+    const RuleSet* rules,
+    HandEvalFunc hand_eval,
+    enum HandType* out_hand_type
+);
+
+/**
+ * @brief Drops every cached result, the counters are left untouched
+ */
+void hand_memo_clear(void);
+
+/**
+ * @brief Returns the hit and miss counters since the last reset
+ */
+const HandMemoStats* hand_memo_get_stats(void);
+
+/**
+ * @brief Resets the hit and miss counters
+ */
+void hand_memo_reset_stats(void);
+
+#endif // HAND_MEMO_H
@@ -0,0 +1,58 @@
+/**
+ * @file hand_type.h
+ *
+ * @brief Poker hand types, kept free of tonc so they can be used by host-side tests
+ */
+#ifndef HAND_TYPE_H
+#define HAND_TYPE_H
+
+#include <stdint.h>
+
+// Hand types
+enum HandType
+{
+    NONE,
+    HIGH_CARD,
+    PAIR,
+    TWO_PAIR,
+    THREE_OF_A_KIND,
+    STRAIGHT,
+    FLUSH,
+    FULL_HOUSE,
+    FOUR_OF_A_KIND,
+    STRAIGHT_FLUSH,
+    ROYAL_FLUSH,
+    FIVE_OF_A_KIND,
+    FLUSH_HOUSE,
+    FLUSH_FIVE
+};
+
+// clang-format off
+// Store all contained hands to optimize "whole hand condition" Jokers
+typedef struct ContainedHandTypes
+{
+    union
+    {
+        struct
+        {
+            uint16_t HIGH_CARD : 1;
+            uint16_t PAIR : 1;
+            uint16_t TWO_PAIR : 1;
+            uint16_t THREE_OF_A_KIND : 1;
+            uint16_t STRAIGHT : 1;
+            uint16_t FLUSH : 1;
+            uint16_t FULL_HOUSE : 1;
+            uint16_t FOUR_OF_A_KIND : 1;
+            uint16_t STRAIGHT_FLUSH : 1;
+            uint16_t ROYAL_FLUSH : 1;
+            uint16_t FIVE_OF_A_KIND : 1;
+            uint16_t FLUSH_HOUSE : 1;
+            uint16_t FLUSH_FIVE : 1;
+            uint16_t : 3;
+        };
+        uint16_t value;
+    };
+} ContainedHandTypes;
+// clang-format on
+
+#endif // HAND_TYPE_H
@@ -4,7 +4,9 @@
 #include "card.h"
 #include "game.h"
 #include "graphic_utils.h"
+#include "list.h"
 #include "sprite.h"
+#include "util.h"
 
 #include <maxmod.h>
 
@@ -69,6 +71,12 @@ enum JokerEvent
                                     // Madness..)
 };
 
+#define NUM_JOKER_EVENTS (JOKER_EVENT_ON_BLIND_SELECTED + 1)
+
+// Bit of a JokerEvent in JokerInfo.event_mask
+#define JOKER_EVENT_BIT(joker_event) (1 << (joker_event))
+#define JOKER_EVENT_MASK_ALL         ((1 << NUM_JOKER_EVENTS) - 1)
+
 // These are flags that can be combined into a single u32 and returned by
 // JokerEffect functions to indicate which fields of the output JokerEffect are valid
 
@@ -92,8 +100,13 @@ enum JokerEvent
 #define BLUEPRINT_JOKER_ID    39
 #define BRAINSTORM_JOKER_ID   40
 #define FOUR_FINGERS_JOKER_ID 48
+#define SMEARED_JOKER_ID      58
+#define LEGACY_WRAP_JOKER_ID  60 // Not in the registry, kept for its wrap-around straight check
+#define MOBIUS_JOKER_ID       100
+#define JAMMING_JOKER_ID      106
+#define CAPTCHA_JOKER_ID      107
 
-typedef struct
+typedef struct Joker
 {
     u8 id;       // Unique ID for the joker, used to identify different jokers
     u8 modifier; // base, foil, holo, poly, negative
@@ -104,6 +117,10 @@ typedef struct
     // retriggered card, etc...)
     s32 scoring_state;
     s32 persistent_state;
+
+    // Blueprint/Brainstorm only: the joker they end up copying, NULL if there is none.
+    // Resolved by joker_resolve_copy_targets() whenever the owned jokers change
+    struct Joker* copied_joker;
 } Joker;
 
 typedef struct JokerObject
@@ -125,14 +142,57 @@ typedef struct // These jokers are triggered after the played hand has finished
     char* message;  // Used to send custom messages e.g. "Extinct!" or "Again!"
 } JokerEffect;
 
+// Running totals joker effects are applied to, the game's chips/mult/money or a preview's
+typedef struct
+{
+    u32 chips;
+    u32 mult;
+    int money;
+    bool retrigger;
+} JokerScoreState;
+
+// Applies the arithmetic of a joker effect to a score state and nothing else, so the scoring
+// loop, the AI lookahead and host simulations all run the same joker math.
+// Only the fields flagged in effect_flags are read from the effect
+static inline void joker_apply_effect(
+    JokerScoreState* state,
+    const JokerEffect* joker_effect,
+    u32 effect_flags
+)
+{
+    if (effect_flags & JOKER_EFFECT_FLAG_RETRIGGER)
+    {
+        state->retrigger = joker_effect->retrigger;
+    }
+    if (effect_flags & JOKER_EFFECT_FLAG_CHIPS)
+    {
+        state->chips = u32_protected_add(state->chips, joker_effect->chips);
+    }
+    if (effect_flags & JOKER_EFFECT_FLAG_MULT)
+    {
+        state->mult = u32_protected_add(state->mult, joker_effect->mult);
+    }
+    // if xmult is zero, DO NOT multiply by it
+    if (effect_flags & JOKER_EFFECT_FLAG_XMULT && joker_effect->xmult > 0)
+    {
+        state->mult = u32_protected_mult(state->mult, joker_effect->xmult);
+    }
+    if (effect_flags & JOKER_EFFECT_FLAG_MONEY)
+    {
+        state->money += joker_effect->money;
+    }
+}
+
 // JokerEffectFuncs take in a joker that will be scored, a scored_card that is not NULL when related
-// to the given joker_event, and output a joker_effect storing the effects of the scored joker They
-// return a set of flags indicating what fields of the joker_effect are valid to access
+// to the given joker_event, and fill the caller's joker_effect with the effects of the scored joker.
+// They return a set of flags indicating what fields of the joker_effect are valid to access.
+// The output belongs to the caller (usually a zeroed JokerEffect on the stack) so effects can be
+// evaluated any number of times, e.g. for previews, without clobbering one another
 typedef u32 (*JokerEffectFunc)(
     Joker* joker,
     Card* scored_card,
     enum JokerEvent joker_event,
-    JokerEffect** joker_effect
+    JokerEffect* joker_effect
 );
 
 typedef struct
@@ -140,6 +200,9 @@ typedef struct
     u8 rarity;
     u8 base_value;
     JokerEffectFunc joker_effect_func;
+    // JOKER_EVENT_BIT() of every event joker_effect_func reacts to, it is never called for the
+    // others. The scoring loop only visits the jokers subscribed to the event being scored
+    u16 event_mask;
 } JokerInfo;
 const JokerInfo* get_joker_registry_entry(int joker_id);
 size_t get_joker_registry_size(void);
@@ -157,9 +220,18 @@ u32 joker_get_score_effect(
     Joker* joker,
     Card* scored_card,
     enum JokerEvent joker_event,
-    JokerEffect** joker_effect
+    JokerEffect* joker_effect
 );
 int joker_get_sell_value(const Joker* joker);
+// Returns the JOKER_EVENT_BIT() mask of the events a joker reacts to, for Blueprint/Brainstorm
+// those of the joker they copy
+u16 joker_get_event_mask(const Joker* joker);
+// Resolves the copy chain of every Blueprint/Brainstorm in a list of JokerObjects and caches the
+// result in their copied_joker, must be called whenever the list changes or is reordered
+void joker_resolve_copy_targets(List* joker_objects);
+// Fills rules from the rule-bending jokers owned (Four Fingers, Shortcut, Smeared...), see
+// is_joker_owned(). game.c caches the result whenever the owned jokers change
+void joker_build_rule_set(RuleSet* rules);
 
 JokerObject* joker_object_new(Joker* joker);
 void joker_object_destroy(JokerObject** joker_object);
@@ -175,6 +247,15 @@ bool joker_object_score(
     CardObject* card_object,
     enum JokerEvent joker_event
 );
+// Shows an effect that was already applied with joker_apply_effect(): the score popups, the
+// chips/mult/money displays and the joker shake. Takes the same card_object as joker_object_score()
+void joker_object_present_effect(
+    JokerObject* joker_object,
+    CardObject* card_object,
+    enum JokerEvent joker_event,
+    const JokerEffect* joker_effect,
+    u32 effect_flags
+);
 
 Sprite* joker_object_get_sprite(JokerObject* joker_object);
 int joker_get_random_rarity();
@@ -0,0 +1,180 @@
+/**
+ * @file rank_histogram.h
+ *
+ * @brief Per-rank card counts packed into a single 64-bit word
+ *
+ * Rank Histogram
+ * ==============
+ *
+ *  - Each of the 13 ranks gets a 4-bit counter, nibble `rank` holding the number of cards of
+ * that rank. Counters saturate at RANK_HISTOGRAM_MAX_COUNT so a nibble never carries into its
+ * neighbour, which lets every counter be tested at once with plain integer arithmetic (SWAR).
+ *
+ *  - The adapters at the bottom convert from and to the `uint8_t counts[NUM_RANKS]` layout.
+ */
+#ifndef RANK_HISTOGRAM_H
+#define RANK_HISTOGRAM_H
+
+#include "card_types.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/**
+ * @def RANK_HISTOGRAM_MAX_COUNT
+ * @brief Count at which a rank counter saturates
+ */
+#define RANK_HISTOGRAM_MAX_COUNT 7
+
+// One bit per rank nibble, used to run the same operation on every counter at once
+#define RANK_HISTOGRAM_ONES 0x0001111111111111ULL
+#define RANK_HISTOGRAM_HIGH (RANK_HISTOGRAM_ONES << 3)
+
+/**
+ * @brief 13 x 4-bit rank counters, see the file documentation
+ */
+typedef uint64_t RankHistogram;
+
+/**
+ * @brief Returns the number of cards of a rank
+ */
+static inline uint8_t rank_hist_count(RankHistogram hist, uint8_t rank)
+{
+    return (hist >> (rank * 4)) & 0xF;
+}
+
+/**
+ * @brief Adds a card of the given rank, saturating at RANK_HISTOGRAM_MAX_COUNT
+ */
+static inline void rank_hist_add(RankHistogram* hist, uint8_t rank)
+{
+    if (rank_hist_count(*hist, rank) < RANK_HISTOGRAM_MAX_COUNT)
+    {
+        *hist += 1ULL << (rank * 4);
+    }
+}
+
+/**
+ * @brief Removes a card of the given rank, the rank must have at least one card
+ */
+static inline void rank_hist_remove(RankHistogram* hist, uint8_t rank)
+{
+    *hist -= 1ULL << (rank * 4);
+}
+
+/**
+ * @brief Adds every counter of another histogram, saturating at RANK_HISTOGRAM_MAX_COUNT
+ */
+static inline void rank_hist_merge(RankHistogram* hist, RankHistogram other)
+{
+    // Two counters of at most 7 sum to at most 14, so no nibble carries into its neighbour.
+    // Nibbles with their high bit set went past the maximum and are clamped back to it.
+    RankHistogram sum = *hist + other;
+    RankHistogram saturated = ((sum & RANK_HISTOGRAM_HIGH) >> 3) * 0xF;
+    *hist = (sum & ~saturated) | (saturated & (RANK_HISTOGRAM_ONES * RANK_HISTOGRAM_MAX_COUNT));
+}
+
+/**
+ * @brief Returns a word with the lowest bit of every nibble set if that rank has at least n cards
+ * @param hist the histogram
+ * @param n the count to test for, 1 <= n <= RANK_HISTOGRAM_MAX_COUNT + 1
+ */
+static inline uint64_t rank_hist_at_least_flags(RankHistogram hist, int n)
+{
+    // Adding 8 - n to a counter sets its high bit exactly when the counter is at least n
+    return ((hist + RANK_HISTOGRAM_ONES * (8 - n)) & RANK_HISTOGRAM_HIGH) >> 3;
+}
+
+/**
+ * @brief Returns true if any rank has at least n cards
+ * @param hist the histogram
+ * @param n the count to test for, 1 <= n <= RANK_HISTOGRAM_MAX_COUNT + 1
+ */
+static inline bool rank_hist_any_at_least(RankHistogram hist, int n)
+{
+    return rank_hist_at_least_flags(hist, n) != 0;
+}
+
+/**
+ * @brief Returns the number of ranks with at least n cards
+ * @param hist the histogram
+ * @param n the count to test for, 1 <= n <= RANK_HISTOGRAM_MAX_COUNT + 1
+ */
+static inline int rank_hist_num_at_least(RankHistogram hist, int n)
+{
+    uint64_t flags = rank_hist_at_least_flags(hist, n);
+    return __builtin_popcount((uint32_t)flags) + __builtin_popcount((uint32_t)(flags >> 32));
+}
+
+/**
+ * @brief Returns the rank mask (bit TWO to bit ACE) of the ranks with at least n cards
+ * @param hist the histogram
+ * @param n the count to test for, 1 <= n <= RANK_HISTOGRAM_MAX_COUNT + 1
+ */
+static inline uint16_t rank_hist_ranks_at_least(RankHistogram hist, int n)
+{
+    // Gather the flag of every nibble into consecutive bits, halving the spread at every step
+    uint64_t flags = rank_hist_at_least_flags(hist, n);
+    flags = (flags | (flags >> 3)) & 0x0303030303030303ULL;
+    flags = (flags | (flags >> 6)) & 0x000F000F000F000FULL;
+    flags = (flags | (flags >> 12)) & 0x000000FF000000FFULL;
+    flags = (flags | (flags >> 24)) & 0xFFFF;
+    return flags;
+}
+
+/**
+ * @brief Returns the highest count of any rank, so a full house returns 3
+ */
+static inline uint8_t rank_hist_max_count(RankHistogram hist)
+{
+    // Binary search over the 3 bits of a counter
+    uint8_t max_count = 0;
+    for (int bit = 4; bit > 0; bit >>= 1)
+    {
+        if (rank_hist_any_at_least(hist, max_count + bit))
+        {
+            max_count += bit;
+        }
+    }
+    return max_count;
+}
+
+/**
+ * @brief Returns the number of ranks with at least a pair
+ */
+static inline int rank_hist_pairs_count(RankHistogram hist)
+{
+    return rank_hist_num_at_least(hist, 2);
+}
+
+/**
+ * @brief Builds a histogram from per-rank counts, counts above RANK_HISTOGRAM_MAX_COUNT saturate
+ * @param counts array of NUM_RANKS counts indexed by rank
+ * @return the histogram
+ */
+static inline RankHistogram rank_hist_from_u8(const uint8_t* counts)
+{
+    RankHistogram hist = 0;
+    for (int rank = 0; rank < NUM_RANKS; rank++)
+    {
+        uint8_t count = counts[rank] < RANK_HISTOGRAM_MAX_COUNT ? counts[rank]
+                                                                : RANK_HISTOGRAM_MAX_COUNT;
+        hist |= (RankHistogram)count << (rank * 4);
+    }
+    return hist;
+}
+
+/**
+ * @brief Unpacks a histogram into per-rank counts
+ * @param hist the histogram
+ * @param counts_out output - array of NUM_RANKS counts indexed by rank
+ */
+static inline void rank_hist_to_u8(RankHistogram hist, uint8_t* counts_out)
+{
+    for (int rank = 0; rank < NUM_RANKS; rank++)
+    {
+        counts_out[rank] = rank_hist_count(hist, rank);
+    }
+}
+
+#endif // RANK_HISTOGRAM_H
@@ -0,0 +1,79 @@
+/**
+ * @file straight_lut.h
+ *
+ * @brief Precomputed straight detection table
+ *
+ * The table itself is generated at build time by scripts/generate_straight_lut.py.
+ */
+#ifndef STRAIGHT_LUT_H
+#define STRAIGHT_LUT_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/**
+ * @def STRAIGHT_LUT_SIZE
+ * @brief Number of entries in the table, one per 13-bit rank presence mask
+ */
+#define STRAIGHT_LUT_SIZE (1 << 13)
+
+/**
+ * @def STRAIGHT_LUT_FOUR_FINGERS
+ * @brief Plane bit for a straight size of 4 instead of 5
+ */
+#define STRAIGHT_LUT_FOUR_FINGERS 0x1
+
+/**
+ * @def STRAIGHT_LUT_SHORTCUT
+ * @brief Plane bit for straights allowed to skip one rank between cards
+ */
+#define STRAIGHT_LUT_SHORTCUT 0x2
+
+/**
+ * @def STRAIGHT_LUT_WRAP
+ * @brief Plane bit for straights allowed to wrap from Ace back to Two (Mobius joker)
+ */
+#define STRAIGHT_LUT_WRAP 0x4
+
+/**
+ * @def STRAIGHT_LUT_LEGACY_WRAP
+ * @brief Plane offset for the legacy wrap-around streak check of joker 60.
+ *
+ * Unlike the Mobius planes, this check counts a skipped rank as part of the streak when
+ * Shortcut is active. Only the four fingers and shortcut plane bits apply to it.
+ */
+#define STRAIGHT_LUT_LEGACY_WRAP 0x8
+
+/**
+ * @brief Straight lookup table indexed by rank presence mask (bit 0 = Two, bit 12 = Ace).
+ *
+ * Bit `p` of an entry is set if the mask contains a straight under the rule combination `p`,
+ * where `p` is a combination of the `STRAIGHT_LUT_*` plane bits.
+ */
+extern const uint16_t straight_lut[STRAIGHT_LUT_SIZE];
+
+/**
+ * @brief Returns the plane of straight_lut matching a set of straight rules
+ * @param four_fingers true if straights only need 4 cards
+ * @param shortcut true if the Shortcut joker is active
+ * @param wrap true if straights may wrap from Ace back to Two
+ * @return the plane index, to be used as `1 << plane`
+ */
+static inline int straight_lut_plane(bool four_fingers, bool shortcut, bool wrap)
+{
+    return (four_fingers ? STRAIGHT_LUT_FOUR_FINGERS : 0) |
+           (shortcut ? STRAIGHT_LUT_SHORTCUT : 0) | (wrap ? STRAIGHT_LUT_WRAP : 0);
+}
+
+/**
+ * @brief Looks up whether a rank presence mask contains a straight
+ * @param rank_mask 13-bit rank presence mask
+ * @param plane plane index from straight_lut_plane(), optionally with STRAIGHT_LUT_LEGACY_WRAP
+ * @return true if the mask contains a straight for this plane
+ */
+static inline bool straight_lut_lookup(uint16_t rank_mask, int plane)
+{
+    return (straight_lut[rank_mask] >> plane) & 0x1;
+}
+
+#endif // STRAIGHT_LUT_H
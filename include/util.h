@@ -15,6 +15,12 @@
  */
 #define GBAL_UNUSED __attribute__((unused))
 
+/**
+ * @def GBAL_ALWAYS_INLINE
+ * @brief Forces a function to be inlined, used where inlining lets constant arguments fold away
+ */
+#define GBAL_ALWAYS_INLINE inline __attribute__((always_inline))
+
 #define UNDEFINED -1
 
 /**
@@ -0,0 +1,162 @@
+#!/usr/bin/env python3
+
+import argparse
+from itertools import combinations_with_replacement
+from math import comb
+
+# Generates the hand classification table used by hand_eval.c when no joker changes the rules.
+#
+# Every multiset of 1 to 5 ranks gets one entry, indexed by a minimal perfect hash of the
+# multiset: with the ranks sorted so that r0 <= r1 <= ... <= r(k-1), the values ri + i are
+# strictly increasing and their combinatorial number system rank, sum(C(ri + i, i + 1)), numbers
+# the multisets of size k from 0 to C(12 + k, k) - 1. An offset per size keeps the sizes apart.
+# See include/hand_class_lut.h for the entry layout.
+
+NUM_RANKS = 13
+MAX_CARDS = 5
+TEN = 8
+ACE = 12
+
+# Same order as enum HandType in include/hand_type.h
+HAND_TYPES = [
+    "NONE",
+    "HIGH_CARD",
+    "PAIR",
+    "TWO_PAIR",
+    "THREE_OF_A_KIND",
+    "STRAIGHT",
+    "FLUSH",
+    "FULL_HOUSE",
+    "FOUR_OF_A_KIND",
+    "STRAIGHT_FLUSH",
+    "ROYAL_FLUSH",
+    "FIVE_OF_A_KIND",
+    "FLUSH_HOUSE",
+    "FLUSH_FIVE",
+]
+HT = {name: i for i, name in enumerate(HAND_TYPES)}
+
+ALL_RANKS_MASK = (1 << NUM_RANKS) - 1
+ROYAL_RANKS = set(range(TEN, ACE + 1))
+WHEEL_RANKS = {ACE, 0, 1, 2, 3}
+
+parser = argparse.ArgumentParser()
+parser.add_argument("-o", "--output", required=True, help="output file")
+
+args = parser.parse_args()
+
+out_path = args.output
+
+
+def size_offset(size):
+    return sum(comb(NUM_RANKS - 1 + k, k) for k in range(1, size))
+
+
+def key_weight(pos, rank):
+    return comb(rank + pos, pos + 1)
+
+
+def key(ranks):
+    return size_offset(len(ranks)) + sum(key_weight(i, r) for i, r in enumerate(sorted(ranks)))
+
+
+def rank_mask(ranks):
+    mask = 0
+    for r in ranks:
+        mask |= 1 << r
+    return mask
+
+
+def classify(ranks):
+    """Returns (hand type, hand type if all cards share a suit, scoring rank mask)"""
+    counts = [ranks.count(r) for r in range(NUM_RANKS)]
+    n_of_a_kind = max(counts)
+    pairs = [r for r in range(NUM_RANKS) if counts[r] >= 2]
+    threes = [r for r in range(NUM_RANKS) if counts[r] >= 3]
+    distinct = set(ranks)
+
+    straight = len(ranks) == MAX_CARDS and len(distinct) == MAX_CARDS and (
+        max(distinct) - min(distinct) == MAX_CARDS - 1 or distinct == WHEEL_RANKS
+    )
+    full_house = len(threes) >= 2 or (len(threes) == 1 and len(pairs) >= 2)
+
+    if n_of_a_kind >= 5:
+        hand_type = HT["FIVE_OF_A_KIND"]
+    elif n_of_a_kind >= 4:
+        hand_type = HT["FOUR_OF_A_KIND"]
+    elif full_house:
+        hand_type = HT["FULL_HOUSE"]
+    elif straight:
+        hand_type = HT["STRAIGHT"]
+    elif n_of_a_kind >= 3:
+        hand_type = HT["THREE_OF_A_KIND"]
+    elif len(pairs) >= 2:
+        hand_type = HT["TWO_PAIR"]
+    elif n_of_a_kind >= 2:
+        hand_type = HT["PAIR"]
+    else:
+        hand_type = HT["HIGH_CARD"]
+
+    # A flush needs five cards of the same suit
+    flush_type = hand_type
+    if len(ranks) == MAX_CARDS:
+        if n_of_a_kind >= 5:
+            flush_type = HT["FLUSH_FIVE"]
+        elif full_house:
+            flush_type = HT["FLUSH_HOUSE"]
+        elif straight and distinct == ROYAL_RANKS:
+            flush_type = HT["ROYAL_FLUSH"]
+        elif straight:
+            flush_type = HT["STRAIGHT_FLUSH"]
+        flush_type = max(flush_type, HT["FLUSH"])
+
+    if hand_type == HT["HIGH_CARD"]:
+        scoring_ranks = 1 << max(ranks)
+    elif hand_type in (HT["PAIR"], HT["TWO_PAIR"]):
+        scoring_ranks = rank_mask(pairs)
+    elif hand_type == HT["THREE_OF_A_KIND"]:
+        scoring_ranks = rank_mask(threes)
+    elif hand_type == HT["FOUR_OF_A_KIND"]:
+        scoring_ranks = rank_mask(r for r in range(NUM_RANKS) if counts[r] >= 4)
+    else:
+        scoring_ranks = ALL_RANKS_MASK
+
+    return hand_type, flush_type, scoring_ranks
+
+
+num_entries = size_offset(MAX_CARDS + 1)
+entries = [None] * num_entries
+for size in range(1, MAX_CARDS + 1):
+    for ranks in combinations_with_replacement(range(NUM_RANKS), size):
+        idx = key(list(ranks))
+        assert entries[idx] is None, "hand class key is not a perfect hash"
+        hand_type, flush_type, scoring_ranks = classify(list(ranks))
+        entries[idx] = hand_type | (flush_type << 4) | (scoring_ranks << 16)
+assert None not in entries, "hand class key is not minimal"
+
+NUM_ENTRIES_IN_ROW = 6
+
+with open(out_path, "w") as out:
+    out.write("// Generated by scripts/generate_hand_class_lut.py, do not edit.\n\n")
+    out.write('#include "hand_class_lut.h"\n\n')
+    out.write("// clang-format off\n")
+
+    out.write("const uint16_t hand_class_key_weights[HAND_CLASS_MAX_CARDS][NUM_RANKS] = {\n")
+    for pos in range(MAX_CARDS):
+        row = [key_weight(pos, r) for r in range(NUM_RANKS)]
+        out.write("    {" + ", ".join(str(w) for w in row) + "},\n")
+    out.write("};\n\n")
+
+    out.write("const uint16_t hand_class_size_offsets[HAND_CLASS_MAX_CARDS + 1] = {\n")
+    out.write("    " + ", ".join(str(size_offset(s)) for s in range(MAX_CARDS + 1)) + ",\n")
+    out.write("};\n\n")
+
+    out.write("const uint32_t hand_class_lut[HAND_CLASS_LUT_SIZE] = {\n")
+    for i in range(0, len(entries), NUM_ENTRIES_IN_ROW):
+        row = entries[i:i + NUM_ENTRIES_IN_ROW]
+        out.write("    " + ", ".join(f"0x{e:08X}" for e in row) + ",\n")
+    out.write("};\n")
+    out.write("// clang-format on\n")
+
+    # Keep the size in the header in sync with the generated table
+    out.write(f'\n_Static_assert(HAND_CLASS_LUT_SIZE == {num_entries}, "Table size mismatch");\n')
@@ -0,0 +1,139 @@
+#!/usr/bin/env python3
+
+import argparse
+
+# Generates the straight lookup table used by hand_analysis.c.
+#
+# The table is indexed by the 13-bit rank presence mask of a hand (bit 0 = Two, bit 12 = Ace,
+# same order as the rank defines in card.h). Every entry is a 16-bit word where each bit answers
+# "does this mask contain a straight?" for one combination of rules, see include/straight_lut.h
+# for the bit layout.
+#
+# The checks below are straight ports of the loops that used to run at runtime, so the table is
+# identical to the old behaviour by construction.
+
+NUM_RANKS = 13
+TWO = 0
+THREE = 1
+FIVE = 3
+QUEEN = 10
+KING = 11
+ACE = 12
+
+STRAIGHT_SIZES = (5, 4)  # Default, Four Fingers
+
+parser = argparse.ArgumentParser()
+parser.add_argument("-o", "--output", required=True, help="output file")
+
+args = parser.parse_args()
+
+out_path = args.output
+
+
+def has_straight(ranks, straight_size, shortcut, mobius):
+    """Port of the runtime hand_contains_straight() (Mobius is joker 100)"""
+    if not shortcut:
+        run = 0
+        # If Mobius is active, loop further to allow ACE to wrap back to TWO
+        limit = NUM_RANKS + straight_size if mobius else NUM_RANKS
+        for i in range(limit):
+            if ranks[i % NUM_RANKS]:
+                run += 1
+                if run >= straight_size:
+                    return True
+            else:
+                run = 0
+
+        # Vanilla Ace-Low check (Only run if Mobius is OFF, as Mobius handles it naturally)
+        if not mobius and straight_size >= 2 and ranks[ACE]:
+            last_needed = TWO + (straight_size - 2)
+            if last_needed <= FIVE:
+                if all(ranks[r] for r in range(TWO, last_needed + 1)):
+                    return True
+        return False
+
+    # Shortcut Joker is active (Dynamic Programming Approach)
+    longest_short_cut_at = [0] * NUM_RANKS
+    ace_low_len = 1 if ranks[ACE] else 0
+    limit = NUM_RANKS * 2 if mobius else NUM_RANKS  # Double scan for Mobius!
+
+    for i in range(limit):
+        r = i % NUM_RANKS
+        if not ranks[r]:
+            longest_short_cut_at[r] = 0
+            continue
+
+        if r == TWO:
+            prev_len1 = longest_short_cut_at[ACE] if mobius else ace_low_len
+            prev_len2 = longest_short_cut_at[KING] if mobius else 0
+        elif r == THREE:
+            prev_len1 = longest_short_cut_at[TWO]
+            prev_len2 = longest_short_cut_at[ACE] if mobius else ace_low_len
+        elif r == ACE:
+            prev_len1 = longest_short_cut_at[KING]
+            prev_len2 = longest_short_cut_at[QUEEN]
+        else:
+            prev_len1 = longest_short_cut_at[r - 1]
+            prev_len2 = longest_short_cut_at[r - 2]
+
+        longest_short_cut_at[r] = 1 + max(prev_len1, prev_len2)
+        if longest_short_cut_at[r] >= straight_size:
+            return True
+
+    return False
+
+
+def has_wrap_streak(ranks, min_len, shortcut):
+    """Port of the joker 60 wrap loop from compute_contained_hand_types()"""
+    streak = 0
+    gaps = 0
+
+    # Loop past 13 to allow the Ace (rank 12) to connect seamlessly to Two (rank 0)
+    for i in range(NUM_RANKS + min_len - 1):
+        if ranks[i % NUM_RANKS]:
+            streak += 1
+            gaps = 0
+            if streak >= min_len:
+                return True
+        elif shortcut and gaps < 1 and streak > 0:
+            streak += 1
+            gaps += 1
+            if streak >= min_len:
+                return True
+        else:
+            streak = 0
+            gaps = 0
+    return False
+
+
+def plane(four_fingers, shortcut, wrap):
+    return (1 if four_fingers else 0) | (2 if shortcut else 0) | (4 if wrap else 0)
+
+
+entries = []
+for mask in range(1 << NUM_RANKS):
+    ranks = [(mask >> r) & 1 for r in range(NUM_RANKS)]
+    entry = 0
+    for straight_size in STRAIGHT_SIZES:
+        four_fingers = straight_size != STRAIGHT_SIZES[0]
+        for shortcut in (False, True):
+            for mobius in (False, True):
+                if has_straight(ranks, straight_size, shortcut, mobius):
+                    entry |= 1 << plane(four_fingers, shortcut, mobius)
+            # The joker 60 planes sit above the Mobius ones and ignore the wrap bit
+            if has_wrap_streak(ranks, straight_size, shortcut):
+                entry |= 1 << (8 + plane(four_fingers, shortcut, False))
+    entries.append(entry)
+
+NUM_ENTRIES_IN_ROW = 8
+
+with open(out_path, "w") as out:
+    out.write("// Generated by scripts/generate_straight_lut.py, do not edit.\n\n")
+    out.write('#include "straight_lut.h"\n\n')
+    out.write("// clang-format off\n")
+    out.write("const uint16_t straight_lut[STRAIGHT_LUT_SIZE] = {\n")
+    for i in range(0, len(entries), NUM_ENTRIES_IN_ROW):
+        row = entries[i:i + NUM_ENTRIES_IN_ROW]
+        out.write("    " + ", ".join(f"0x{e:04X}" for e in row) + ",\n")
+    out.write("};\n")
+    out.write("// clang-format on\n")
@@ -4,10 +4,13 @@
  * Provides a purely algorithmic card-selection routine that the game loop can
  * invoke instead of player input when it is the AI's turn.
  *
- * The AI does NOT simulate joker effects in its hand-evaluation heuristic.
- * The actual engine scoring path runs unchanged during the AI's turn, so
- * every joker the player owns (DEFAULT_JOKER, GREEDY_JOKER, etc.) applies
- * its effect to the AI's scored cards exactly as it would for the player.
+ * The subset search ranks hands by their base chips and mult. When jokers
+ * are owned, the best few subsets are then rescored by running the owned
+ * jokers' effects on copies of their state (see ai_score_with_jokers()), so
+ * the AI picks the hand the jokers actually favour. The real engine scoring
+ * path still runs unchanged during the AI's turn, so every joker the player
+ * owns applies its effect to the AI's scored cards exactly as it would for
+ * the player.
  */
 
 #include "ai_player.h"
@@ -15,217 +18,1580 @@
 #include "card.h"
 #include "game.h"
 #include "hand_analysis.h"
+#include "hand_memo.h"
+#include "joker.h"
+#include "list.h"
+#include "util.h"
 
 #include <tonc.h>
 
 /* -----------------------------------------------------------------------
- * Local copy of hand base values (mirrors the static table in game.c so
- * ai_player.c does not need an exported getter).
+ * Standalone hand-type computation.
+ *
+ * Uses the same evaluation core as compute_contained_hand_types() in
+ * game.c but on a bitboard of explicit cards so it doesn't touch the
+ * global hand[]/selection state.
  * ----------------------------------------------------------------------- */
+static enum HandType ai_compute_hand_type(
+    const HandBitboard* bb,
+    HandEvalFunc hand_eval,
+    const RuleSet* rules
+)
+{
+    if (bb->rank_mask == 0)
+        return NONE;
+
+    /* Without rule-bending jokers the hand type is a single table lookup. */
+    if (rule_set_is_vanilla(rules))
+        return hand_eval_vanilla_type(bb);
+
+    enum HandType hand_type;
+    hand_memo_eval(bb, rules, hand_eval, &hand_type);
+    return hand_type;
+}
+
+/* -----------------------------------------------------------------------
+ * Score estimate for a hand type and the summed chip value of its cards.
+ *
+ * Used only for comparison during AI hand selection; does NOT modify any
+ * global game state.
+ * ----------------------------------------------------------------------- */
+static u32 ai_score_combo(enum HandType ht, u32 card_chips)
+{
+    if (ht == NONE)
+        return 0;
+
+    /* Played cards add their chip value (mirrors PLAY_SCORING_CARDS). */
+    const HandValues* base = hand_eval_base_values(ht);
+    u32 c = base->chips + card_chips;
+    u32 m = base->mult;
+
+    /* Guard against 32-bit overflow (mirrors u32_protected_mult in game.c). */
+    if (c == 0 || m == 0)
+        return 0;
+    if (c > 0xFFFFFFFF / m)
+        return 0xFFFFFFFF;
+
+    return c * m;
+}
+
+/* -----------------------------------------------------------------------
+ * Transposition cache of subset scores.
+ *
+ * Base score and hand type of the subsets the search visits, keyed by the
+ * set of cards (bit suit * NUM_RANKS + rank, as in hand_memo.c) and the
+ * rule bits. After a discard most of the hand is unchanged, so the next
+ * decision finds most of its subsets here instead of evaluating them again.
+ * Direct-mapped and much larger than the hand memo, so it lives in EWRAM.
+ *
+ * Entries only depend on the cards and the rules, the table is dropped
+ * whenever the owned jokers change, see ai_score_cache_clear(). Hands
+ * holding the same card twice can't be keyed and bypass the cache.
+ * ----------------------------------------------------------------------- */
+#define AI_SCORE_CACHE_INDEX_BITS  10
+#define AI_SCORE_CACHE_NUM_ENTRIES (1 << AI_SCORE_CACHE_INDEX_BITS)
+#define AI_SCORE_CACHE_RULES_SHIFT 52
+#define AI_SCORE_CACHE_KEY_VALID   (1ULL << 63)
+
 typedef struct
 {
-    u32 chips;
-    u32 mult;
-} AIHandBaseValues;
-
-static const AIHandBaseValues ai_hand_base[] = {
-    {  0,   0 }, // NONE
-    {  5,   1 }, // HIGH_CARD
-    { 10,   2 }, // PAIR
-    { 20,   2 }, // TWO_PAIR
-    { 30,   3 }, // THREE_OF_A_KIND
-    { 30,   4 }, // STRAIGHT
-    { 35,   4 }, // FLUSH
-    { 40,   4 }, // FULL_HOUSE
-    { 60,   7 }, // FOUR_OF_A_KIND
-    {100,   8 }, // STRAIGHT_FLUSH
-    {100,   8 }, // ROYAL_FLUSH
-    {120,  12 }, // FIVE_OF_A_KIND
-    {140,  14 }, // FLUSH_HOUSE
-    {160,  16 }, // FLUSH_FIVE
-};
+    u64 key;
+    u32 score;
+    u8  ht;
+} AIScoreCacheEntry;
+
+static EWRAM_BSS AIScoreCacheEntry ai_score_cache[AI_SCORE_CACHE_NUM_ENTRIES];
+
+static inline u64 ai_score_cache_card_set(const HandBitboard* bb)
+{
+    u64 card_set = 0;
+    for (int suit = 0; suit < NUM_SUITS; suit++)
+        card_set |= (u64)bb->suit_ranks[suit] << (suit * NUM_RANKS);
+    return card_set;
+}
+
+/* Only the rules that change the hand types go into the key. */
+static inline u64 ai_score_cache_rule_bits(const RuleSet* rules)
+{
+    u64 bits = HAND_EVAL_VARIANT_IDX(
+        rules->straight_size == STRAIGHT_AND_FLUSH_SIZE_FOUR_FINGERS,
+        rules->shortcut,
+        rules->smeared,
+        rules->mobius_wrap
+    );
+    bits |= rules->legacy_wrap ? HAND_EVAL_NUM_VARIANTS : 0;
+    return (bits << AI_SCORE_CACHE_RULES_SHIFT) | AI_SCORE_CACHE_KEY_VALID;
+}
+
+static inline AIScoreCacheEntry* ai_score_cache_entry(u64 key)
+{
+    /* Fibonacci hashing of the folded key, the top bits are the best mixed. */
+    u32 folded = (u32)key ^ (u32)(key >> 32);
+    return &ai_score_cache[(folded * 0x9E3779B1u) >> (32 - AI_SCORE_CACHE_INDEX_BITS)];
+}
 
 /* -----------------------------------------------------------------------
- * Standalone hand-type computation.
+ * Joker-aware score of a subset.
  *
- * Mirrors compute_contained_hand_types() / compute_hand_type() in game.c
- * but operates on an explicit Card** array so it doesn't touch the global
- * hand[]/selection state.
+ * Replays the scoring sequence of the PLAY_SCORING_* states on a hand that
+ * is not played: hand played, then every scoring card with its retriggers,
+ * then the held cards, then the independent jokers. The game's scoring
+ * getters are pointed at a ScorePreview holding the subset and a scratch
+ * chips/mult accumulator, and every joker runs on a copy of its state, so
+ * nothing here changes the game, the owned jokers or the screen.
  * ----------------------------------------------------------------------- */
-static enum HandType ai_compute_hand_type(Card** cards, int count)
+
+/* Upper bound on retriggers of a single card, real retrigger jokers stop on
+ * their own well before this. */
+#define AI_MAX_RETRIGGERS 4
+
+typedef struct
 {
-    if (count <= 0)
-        return NONE;
+    Joker        jokers[MAX_ACTIVE_JOKERS];  /* Copies of the owned jokers, list order */
+    const Joker* sources[MAX_ACTIVE_JOKERS]; /* The owned jokers they were copied from */
+    int          count;
+    int          first;                      /* Jamming skips the leftmost joker */
+    bool         retrigger;
+} AIJokerSandbox;
+
+/* Index of the joker a Blueprint/Brainstorm at idx copies, -1 if none.
+ * The game already resolved the copy chain, see joker_resolve_copy_targets(),
+ * it only has to be mapped onto the sandbox copies. */
+static int ai_sandbox_copy_target(const AIJokerSandbox* sandbox, int idx)
+{
+    const Joker* copied_joker = sandbox->jokers[idx].copied_joker;
+
+    for (int j = 0; j < sandbox->count && copied_joker != NULL; j++)
+    {
+        if (sandbox->sources[j] == copied_joker)
+            return j;
+    }
+
+    return -1;
+}
 
-    u8 ranks[NUM_RANKS] = {0};
-    u8 suits[NUM_SUITS] = {0};
+static void ai_sandbox_score_joker(
+    AIJokerSandbox* sandbox,
+    ScorePreview* preview,
+    int idx,
+    Card* card,
+    enum JokerEvent event
+)
+{
+    Joker* joker = &sandbox->jokers[idx];
+    const JokerInfo* info;
 
+    /* Copying jokers find themselves by address in the owned list, which a
+     * copy can't match, so the copy chain is followed here instead. */
+    if (joker->id == BLUEPRINT_JOKER_ID || joker->id == BRAINSTORM_JOKER_ID)
+    {
+        int target = ai_sandbox_copy_target(sandbox, idx);
+        if (target < 0)
+            return;
+
+        joker->persistent_state = sandbox->jokers[target].persistent_state;
+        info = get_joker_registry_entry(sandbox->jokers[target].id);
+    }
+    else
+    {
+        info = get_joker_registry_entry(joker->id);
+    }
+
+    if (info == NULL || !(info->event_mask & JOKER_EVENT_BIT(event)))
+        return;
+
+    JokerEffect effect = {0};
+    u32 flags = info->joker_effect_func(joker, card, event, &effect);
+    if (flags == JOKER_EFFECT_FLAG_NONE)
+        return;
+
+    /* Same arithmetic as joker_object_score(), minus the presentation. */
+    JokerScoreState state = {
+        .chips     = preview->chips,
+        .mult      = preview->mult,
+        .retrigger = sandbox->retrigger,
+    };
+    joker_apply_effect(&state, &effect, flags);
+
+    preview->chips     = state.chips;
+    preview->mult      = state.mult;
+    sandbox->retrigger = state.retrigger;
+}
+
+static void ai_sandbox_score_event(
+    AIJokerSandbox* sandbox,
+    ScorePreview* preview,
+    Card* card,
+    enum JokerEvent event
+)
+{
+    for (int j = sandbox->first; j < sandbox->count; j++)
+        ai_sandbox_score_joker(sandbox, preview, j, card, event);
+}
+
+/* Scores one played card and its retriggers. */
+static void ai_sandbox_score_card(AIJokerSandbox* sandbox, ScorePreview* preview, Card* card)
+{
+    for (int retriggers = 0; retriggers <= AI_MAX_RETRIGGERS; retriggers++)
+    {
+        u8 card_value = card_get_value(card);
+        if (is_joker_owned(CAPTCHA_JOKER_ID) && card_is_face(card))
+            card_value = 0; /* Mirrors the CAPTCHA hook of the scoring loop */
+
+        preview->chips = u32_protected_add(preview->chips, card_value);
+        ai_sandbox_score_event(sandbox, preview, card, JOKER_EVENT_ON_CARD_SCORED);
+
+        /* The first retrigger restarts the card, the jokers after it only
+         * get to run on the retriggered pass. */
+        bool retriggered = false;
+        for (int j = sandbox->first; j < sandbox->count && !retriggered; j++)
+        {
+            sandbox->retrigger = false;
+            ai_sandbox_score_joker(sandbox, preview, j, card, JOKER_EVENT_ON_CARD_SCORED_END);
+            retriggered = sandbox->retrigger;
+        }
+
+        if (!retriggered)
+            break;
+    }
+}
+
+static u32 ai_score_with_jokers(
+    Card** hand,
+    int count,
+    u32 mask,
+    const RuleSet* rules,
+    HandEvalFunc hand_eval
+)
+{
+    Card*        played_cards[MAX_SELECTION_SIZE];
+    CardObject   held_objects[MAX_HAND_SIZE] = {0};
+    CardObject*  held[MAX_HAND_SIZE];
+    int          played_count = 0;
+    int          held_count   = 0;
+    HandBitboard bb;
+
+    /* Cards keep their hand order, like the played stack does. */
+    hand_bitboard_clear(&bb);
     for (int i = 0; i < count; i++)
     {
-        if (cards[i])
+        if (mask & (1u << i))
+        {
+            played_cards[played_count++] = hand[i];
+            hand_bitboard_add_card(&bb, hand[i]);
+        }
+        else
         {
-            ranks[cards[i]->rank]++;
-            suits[cards[i]->suit]++;
+            held_objects[held_count].card = hand[i];
+            held[held_count] = &held_objects[held_count];
+            held_count++;
         }
     }
 
-    /* Build a ContainedHandTypes bitfield.
-     * This replicates compute_contained_hand_types() logic exactly. */
-    ContainedHandTypes ct = {0};
+    AIJokerSandbox sandbox = {0};
+    ListItr itr = list_itr_create(get_jokers_list());
+    JokerObject* joker_object;
+    while ((joker_object = list_itr_next(&itr)) && sandbox.count < MAX_ACTIVE_JOKERS)
+    {
+        sandbox.sources[sandbox.count] = joker_object->joker;
+        sandbox.jokers[sandbox.count++] = *joker_object->joker;
+    }
+
+    /* Mirrors the Jamming hook of the scoring loop. */
+    if (is_joker_owned(JAMMING_JOKER_ID))
+        sandbox.first = 1;
+
+    ScorePreview preview = {
+        .contained_hands = hand_eval(&bb, rules),
+        .played_top      = played_count - 1,
+        .held            = held,
+        .held_top        = held_count - 1,
+    };
+    preview.hand_type = hand_eval_highest_type(preview.contained_hands);
+    preview.chips     = hand_eval_base_values(preview.hand_type)->chips;
+    preview.mult      = hand_eval_base_values(preview.hand_type)->mult;
 
-    ct.HIGH_CARD = 1;
+    uint8_t scoring_mask =
+        hand_eval_scoring_mask(&bb, played_cards, played_count, preview.hand_type, rules);
 
-    u8 n = hand_contains_n_of_a_kind(ranks);
+    game_set_score_preview(&preview);
 
-    if (n >= 2)
+    ai_sandbox_score_event(&sandbox, &preview, NULL, JOKER_EVENT_ON_HAND_PLAYED);
+
+    for (int i = 0; i < played_count; i++)
+    {
+        if (scoring_mask & (1 << i))
+        {
+            preview.scored_card_index = i;
+            ai_sandbox_score_card(&sandbox, &preview, played_cards[i]);
+        }
+    }
+
+    for (int i = held_count - 1; i >= 0; i--)
     {
-        ct.PAIR = 1;
-        if (hand_contains_two_pair(ranks))
-            ct.TWO_PAIR = 1;
+        preview.scored_card_index = i;
+        ai_sandbox_score_event(&sandbox, &preview, held[i]->card, JOKER_EVENT_ON_CARD_HELD);
     }
 
-    if (n >= 3)
-        ct.THREE_OF_A_KIND = 1;
+    preview.scored_card_index = 0;
+    ai_sandbox_score_event(&sandbox, &preview, NULL, JOKER_EVENT_INDEPENDENT);
 
-    /* NOTE: hand_contains_straight / hand_contains_flush use
-     * get_straight_and_flush_size() and is_shortcut_joker_active() from game.c.
-     * During the AI's turn those globals reflect the AI's (empty) joker list,
-     * so straight_size == 5 and shortcut == false — which is the desired
-     * behaviour. */
-    if (hand_contains_straight(ranks))
-        ct.STRAIGHT = 1;
+    game_set_score_preview(NULL);
+
+    return u32_protected_mult(preview.chips, preview.mult);
+}
 
-    if (hand_contains_flush(suits))
-        ct.FLUSH = 1;
+/* -----------------------------------------------------------------------
+ * Difficulty levels.
+ *
+ * A level bounds how far the AI looks: the largest subset it tries, whether
+ * jokers are taken into account, how much CPU time one decision may take
+ * and how the discards are chosen. The budget covers the whole decision, the
+ * hand search and then the discard decision, however many frames they are
+ * spread over, see ai_search_run() and ai_planner_run().
+ * ----------------------------------------------------------------------- */
+static const AILevelInfo ai_level_infos[AI_NUM_LEVELS] = {
+    [AI_LEVEL_GREEDY] = {
+        .name                   = "GREEDY",
+        .decision_budget_cycles = AI_FRAME_CYCLES / 2,
+        .search_depth           = MAX_SELECTION_SIZE,
+        .joker_aware            = false,
+        .planner_samples        = 0,
+    },
+    [AI_LEVEL_JOKER_AWARE] = {
+        .name                   = "JOKERS",
+        .decision_budget_cycles = AI_FRAME_CYCLES * 5,
+        .search_depth           = MAX_SELECTION_SIZE,
+        .joker_aware            = true,
+        .planner_samples        = 0,
+    },
+    [AI_LEVEL_PLANNER] = {
+        .name                   = "PLANNER",
+        .decision_budget_cycles = AI_FRAME_CYCLES * 10,
+        .search_depth           = MAX_SELECTION_SIZE,
+        .joker_aware            = true,
+        .planner_samples        = AI_PLANNER_DEFAULT_SAMPLES,
+    },
+};
+
+static enum AILevel       ai_level_id = AI_LEVEL_GREEDY;
+static const AILevelInfo* ai_level    = &ai_level_infos[AI_LEVEL_GREEDY];
+
+/* -----------------------------------------------------------------------
+ * Subset search.
+ *
+ * Walks every combination of 1..max_sel cards depth-first, adding one card
+ * to a running bitboard and chip total per step and restoring them on the
+ * way back up, so no subset is ever rebuilt from scratch and subsets larger
+ * than max_sel are never generated.
+ *
+ * Branch and bound: before descending, the best score any extension of the
+ * current subset could reach is estimated from the hand type of the current
+ * cards plus every remaining card, and the highest chip values that still
+ * fit. Branches that can't beat the best subset so far are skipped, and a
+ * greedy seed makes that best subset good from the start.
+ *
+ * The walk keeps its own stack instead of recursing so that it can stop
+ * after any subset and pick up from the same place on the next frame.
+ *
+ * When jokers are owned, the search keeps the AI_JOKER_CANDIDATES_PER_SIZE
+ * best subsets of every size instead of only the best one, and a branch is
+ * only cut if it can't make any of them. Once the walk is over they are
+ * rescored with the jokers, one per step, and the best joker-aware score
+ * wins. Keeping every size lets jokers like Half Joker pull the choice
+ * towards small hands the base score alone would never rank first.
+ * ----------------------------------------------------------------------- */
+
+/* One level of the walk: the subset of `level` cards is extended with card
+ * `next` next, `saved_bb` is the bitboard before the last card was added. */
+typedef struct
+{
+    int          next;
+    HandBitboard saved_bb;
+} AISearchLevel;
+
+typedef struct
+{
+    u32           score;
+    u32           mask;
+    int           count;
+    enum HandType ht;
+} AICandidate;
+
+typedef struct
+{
+    Card*          hand[MAX_HAND_SIZE];
+    int            count;
+    int            max_sel;
+    RuleSet        rules;
+    HandEvalFunc   hand_eval;
+    u8             card_chips[MAX_HAND_SIZE];
 
-    if (n >= 3 && hand_contains_full_house(ranks))
-        ct.FULL_HOUSE = 1;
+    /* Whether subset scores go through the transposition cache, and the
+     * rule bits of its keys. */
+    bool           use_cache;
+    u64            cache_rule_bits;
 
-    if (n >= 4)
-        ct.FOUR_OF_A_KIND = 1;
+    /* suffix_bb[i] holds cards i..count-1, suffix_top_chips[i][k] the sum
+     * of the k highest chip values among them. */
+    HandBitboard   suffix_bb[MAX_HAND_SIZE + 1];
+    u16            suffix_top_chips[MAX_HAND_SIZE + 1][MAX_SELECTION_SIZE + 1];
 
-    if (ct.STRAIGHT && ct.FLUSH)
-        ct.STRAIGHT_FLUSH = 1;
+    /* Subset currently being visited. */
+    HandBitboard   bb;
+    u32            chips;
+    u32            mask;
+    int            size;
+    AISearchLevel  levels[MAX_SELECTION_SIZE + 1];
+    bool           walk_done;
+    bool           done;
 
-    if (ct.STRAIGHT_FLUSH &&
-        ranks[TEN] && ranks[JACK] && ranks[QUEEN] && ranks[KING] && ranks[ACE])
-        ct.ROYAL_FLUSH = 1;
+    /* Best subsets so far by base score, best first in each bucket. With
+     * jokers bucket b holds subsets of b + 1 cards, otherwise there is a
+     * single bucket holding the best subset of any size. */
+    bool           use_jokers;
+    int            num_buckets;
+    int            bucket_size;
+    AICandidate    best[MAX_SELECTION_SIZE][AI_JOKER_CANDIDATES_PER_SIZE];
+    int            num_best[MAX_SELECTION_SIZE];
 
-    if (n >= 5)
-        ct.FIVE_OF_A_KIND = 1;
+    /* Joker-aware rescoring of best[], see ai_score_with_jokers(). */
+    int                num_rescored;
+    const AICandidate* chosen;
+    u32                chosen_score;
 
-    if (ct.FLUSH)
+    /* The level the search was started with and what is left of its
+     * decision budget, see ai_search_run(). */
+    const AILevelInfo* level;
+    u32                cycles_left;
+} AISearch;
+
+static inline int ai_bucket_of(const AISearch* search, int size)
+{
+    return search->use_jokers ? size - 1 : 0;
+}
+
+/* Returns true if a subset ranks before a candidate, ties go to the lowest
+ * mask, the order the old mask loop visited. */
+static inline bool ai_ranks_before(u32 score, u32 mask, const AICandidate* candidate)
+{
+    return score > candidate->score || (score == candidate->score && mask < candidate->mask);
+}
+
+static void ai_search_consider(
+    AISearch* search,
+    const HandBitboard* bb,
+    u32 chips,
+    u32 mask,
+    int size
+)
+{
+    enum HandType ht;
+    u32           s;
+
+    if (search->use_cache)
+    {
+        u64                key   = ai_score_cache_card_set(bb) | search->cache_rule_bits;
+        AIScoreCacheEntry* entry = ai_score_cache_entry(key);
+        if (entry->key != key)
+        {
+            ht           = ai_compute_hand_type(bb, search->hand_eval, &search->rules);
+            entry->key   = key;
+            entry->score = ai_score_combo(ht, chips);
+            entry->ht    = ht;
+        }
+        ht = entry->ht;
+        s  = entry->score;
+    }
+    else
+    {
+        ht = ai_compute_hand_type(bb, search->hand_eval, &search->rules);
+        s  = ai_score_combo(ht, chips);
+    }
+
+    int          b      = ai_bucket_of(search, size);
+    AICandidate* bucket = search->best[b];
+    int*         num    = &search->num_best[b];
+
+    if (s == 0)
+        return;
+    if (*num == search->bucket_size && !ai_ranks_before(s, mask, &bucket[*num - 1]))
+        return;
+
+    /* The seeds may be visited again by the walk. */
+    for (int k = 0; k < *num; k++)
+    {
+        if (bucket[k].mask == mask)
+            return;
+    }
+
+    /* Insert in order, dropping the worst candidate if the bucket is full. */
+    int pos = (*num < search->bucket_size) ? (*num)++ : *num - 1;
+    while (pos > 0 && ai_ranks_before(s, mask, &bucket[pos - 1]))
+    {
+        bucket[pos] = bucket[pos - 1];
+        pos--;
+    }
+
+    bucket[pos] = (AICandidate){ .score = s, .mask = mask, .count = size, .ht = ht };
+}
+
+static void ai_search_prepare(AISearch* search)
+{
+    u8 top[MAX_SELECTION_SIZE] = {0}; /* Highest chip values so far, descending */
+
+    hand_bitboard_clear(&search->suffix_bb[search->count]);
+    for (int k = 0; k <= MAX_SELECTION_SIZE; k++)
+        search->suffix_top_chips[search->count][k] = 0;
+
+    for (int i = search->count - 1; i >= 0; i--)
+    {
+        search->card_chips[i] = card_get_value(search->hand[i]);
+
+        search->suffix_bb[i] = search->suffix_bb[i + 1];
+        hand_bitboard_add_card(&search->suffix_bb[i], search->hand[i]);
+
+        /* Insert the card's chips into the sorted top list. */
+        u8 value = search->card_chips[i];
+        for (int k = 0; k < MAX_SELECTION_SIZE; k++)
+        {
+            if (value > top[k])
+            {
+                u8 tmp = top[k];
+                top[k] = value;
+                value  = tmp;
+            }
+        }
+
+        search->suffix_top_chips[i][0] = 0;
+        for (int k = 1; k <= MAX_SELECTION_SIZE; k++)
+            search->suffix_top_chips[i][k] = search->suffix_top_chips[i][k - 1] + top[k - 1];
+    }
+}
+
+/* Seeds the best subset with the largest N of a kind and the largest flush. */
+static void ai_search_seed(AISearch* search)
+{
+    const HandBitboard* all = &search->suffix_bb[0];
+
+    u8  max_count  = rank_hist_max_count(all->rank_counts);
+    u16 best_ranks = rank_hist_ranks_at_least(all->rank_counts, max_count);
+    int seed_rank  = 31 - __builtin_clz(best_ranks);
+
+    int seed_suit = 0;
+    for (int suit = 1; suit < NUM_SUITS; suit++)
+    {
+        if (hand_bitboard_suit_count(all, suit) > hand_bitboard_suit_count(all, seed_suit))
+            seed_suit = suit;
+    }
+
+    for (int seed = 0; seed < 2; seed++)
+    {
+        HandBitboard bb;
+        u32 chips = 0;
+        u32 mask  = 0;
+        int size  = 0;
+
+        hand_bitboard_clear(&bb);
+        for (int i = 0; i < search->count && size < search->max_sel; i++)
+        {
+            Card* card = search->hand[i];
+            if (seed == 0 ? card->rank != seed_rank : card->suit != seed_suit)
+                continue;
+
+            hand_bitboard_add_card(&bb, card);
+            chips += search->card_chips[i];
+            mask  |= 1u << i;
+            size++;
+        }
+
+        ai_search_consider(search, &bb, chips, mask, size);
+    }
+}
+
+/* Returns true if some extension of the current subset with cards from
+ * `first` onwards might beat the best subset so far. */
+static bool ai_search_may_improve(const AISearch* search, int first)
+{
+    if (first >= search->count || search->size >= search->max_sel)
+        return false;
+
+    /* Hand types only grow when cards are added, so the type of the current
+     * cards plus every remaining card bounds the type of any extension, and
+     * the base chips and mult grow with the type. */
+    HandBitboard pool = search->bb;
+    hand_bitboard_merge(&pool, &search->suffix_bb[first]);
+    enum HandType max_ht = hand_eval_highest_type(search->hand_eval(&pool, &search->rules));
+
+    int slots = search->max_sel - search->size;
+    u32 bound = ai_score_combo(max_ht, search->chips + search->suffix_top_chips[first][slots]);
+
+    /* The bound holds for every size the branch can reach, so the branch
+     * is only cut if it can't make any bucket of those sizes. Every mask
+     * below this branch is above the current one, so a tie only wins if the
+     * current mask is still below the worst kept one. */
+    int first_bucket = ai_bucket_of(search, search->size + 1);
+    int last_bucket  = ai_bucket_of(search, search->max_sel);
+
+    for (int b = first_bucket; b <= last_bucket; b++)
     {
-        if (ct.FULL_HOUSE)
-            ct.FLUSH_HOUSE = 1;
-        if (ct.FIVE_OF_A_KIND)
-            ct.FLUSH_FIVE = 1;
+        if (search->num_best[b] < search->bucket_size ||
+            ai_ranks_before(bound, search->mask, &search->best[b][search->bucket_size - 1]))
+            return true;
     }
 
-    /* Return the highest hand type by iterating from strongest to weakest. */
-    for (enum HandType h = FLUSH_FIVE; h > NONE; h--)
+    return false;
+}
+
+/* Sets up a search over the given cards, seeded but not yet walked. */
+static void ai_search_init(AISearch* search, Card** hand, int count)
+{
+    if (count > MAX_HAND_SIZE)
+        count = MAX_HAND_SIZE;
+    if (count < 0)
+        count = 0;
+
+    for (int i = 0; i < count; i++)
+        search->hand[i] = hand[i];
+
+    search->count   = count;
+    /* Limit to MAX_SELECTION_SIZE cards and to what is actually available. */
+    search->max_sel = (count < MAX_SELECTION_SIZE) ? count : MAX_SELECTION_SIZE;
+    if (search->max_sel > ai_level->search_depth)
+        search->max_sel = ai_level->search_depth;
+    /* Rules derived from the jokers in play, cached by game.c. They are copied
+     * so a search spread over several frames sticks to the same rules, and the
+     * evaluator specialized for them is picked once for the whole search. */
+    search->rules     = *get_rule_set();
+    search->hand_eval = hand_eval_select_variant(&search->rules);
+
+    hand_bitboard_clear(&search->bb);
+    search->chips = 0;
+    search->mask  = 0;
+    search->size  = 0;
+
+    /* Without jokers the base score is the whole story, so only the best
+     * subset is kept and nothing is rescored. */
+    search->use_jokers   = ai_level->joker_aware && list_get_len(get_jokers_list()) > 0;
+    search->level        = ai_level;
+    search->cycles_left  = ai_level->decision_budget_cycles;
+    search->num_buckets  = search->use_jokers ? search->max_sel : 1;
+    search->bucket_size  = search->use_jokers ? AI_JOKER_CANDIDATES_PER_SIZE : 1;
+    search->num_rescored = 0;
+    search->chosen       = NULL;
+    search->chosen_score = 0;
+    for (int b = 0; b < MAX_SELECTION_SIZE; b++)
+        search->num_best[b] = 0;
+
+    if (count == 0)
+    {
+        search->walk_done = true;
+        search->done      = true;
+        return;
+    }
+
+    ai_search_prepare(search);
+
+    /* A duplicated card would make two subsets share a key. */
+    u64 card_set            = ai_score_cache_card_set(&search->suffix_bb[0]);
+    int num_distinct        = __builtin_popcount((u32)card_set) +
+                              __builtin_popcount((u32)(card_set >> 32));
+    search->use_cache       = num_distinct == count;
+    search->cache_rule_bits = ai_score_cache_rule_bits(&search->rules);
+
+    ai_search_seed(search);
+
+    search->levels[0].next = ai_search_may_improve(search, 0) ? 0 : count;
+    search->walk_done = false;
+    search->done      = false;
+}
+
+/* Hardware timers 2 and 3 cascaded into a 32-bit CPU cycle counter, the
+ * same setup as tonc's profile_start(). Timer 0 and 1 are left to the sound
+ * mixer. */
+static inline void ai_timer_start(void)
+{
+    REG_TM2CNT = 0;
+    REG_TM3CNT = 0;
+    REG_TM2D   = 0; /* Reload values, loaded into the counters on enable */
+    REG_TM3D   = 0;
+    REG_TM3CNT = TM_ENABLE | TM_CASCADE;
+    REG_TM2CNT = TM_FREQ_1 | TM_ENABLE;
+}
+
+static inline u32 ai_timer_cycles(void)
+{
+    /* Read the high half again in case the low half wrapped in between. */
+    u16 high, low;
+    do
+    {
+        high = REG_TM3D;
+        low  = REG_TM2D;
+    } while (high != REG_TM3D);
+
+    return ((u32)high << 16) | low;
+}
+
+static inline void ai_timer_stop(void)
+{
+    REG_TM2CNT = 0;
+    REG_TM3CNT = 0;
+}
+
+/* Visits the next subset of the walk, or backs up one level. */
+static void ai_search_walk_step(AISearch* search)
+{
+    AISearchLevel* level = &search->levels[search->size];
+
+    if (level->next >= search->count)
+    {
+        /* Level exhausted, take back the card the level below added. */
+        if (search->size == 0)
+        {
+            search->walk_done = true;
+            return;
+        }
+
+        AISearchLevel* parent = &search->levels[search->size - 1];
+        int i = parent->next - 1;
+
+        /* Copying the bitboard back is exact even for duplicated cards,
+         * unlike hand_bitboard_remove_card(). */
+        search->bb     = parent->saved_bb;
+        search->chips -= search->card_chips[i];
+        search->mask  &= ~(1u << i);
+        search->size--;
+        return;
+    }
+
+    int i = level->next++;
+
+    level->saved_bb = search->bb;
+    hand_bitboard_add_card(&search->bb, search->hand[i]);
+    search->chips += search->card_chips[i];
+    search->mask  |= 1u << i;
+    search->size++;
+
+    ai_search_consider(search, &search->bb, search->chips, search->mask, search->size);
+
+    /* Descend into the extensions of this subset, or skip them all. */
+    search->levels[search->size].next =
+        ai_search_may_improve(search, i + 1) ? i + 1 : search->count;
+}
+
+/* Rescores the next candidate with the owned jokers. */
+static void ai_search_rescore_step(AISearch* search)
+{
+    if (!search->use_jokers)
+    {
+        search->chosen = (search->num_best[0] > 0) ? &search->best[0][0] : NULL;
+        search->done   = true;
+        return;
+    }
+
+    while (search->num_rescored < search->num_buckets * search->bucket_size)
+    {
+        int b = search->num_rescored / search->bucket_size;
+        int k = search->num_rescored % search->bucket_size;
+        search->num_rescored++;
+
+        if (k >= search->num_best[b])
+            continue;
+
+        const AICandidate* candidate = &search->best[b][k];
+        u32 s = ai_score_with_jokers(
+            search->hand,
+            search->count,
+            candidate->mask,
+            &search->rules,
+            search->hand_eval
+        );
+
+        /* Ties keep the candidate with the better base score. */
+        if (search->chosen == NULL || s > search->chosen_score ||
+            (s == search->chosen_score &&
+             ai_ranks_before(candidate->score, candidate->mask, search->chosen)))
+        {
+            search->chosen       = candidate;
+            search->chosen_score = s;
+        }
+        return;
+    }
+
+    search->done = true;
+}
+
+/* Ends the search early with the best subset found so far. */
+static void ai_search_cut(AISearch* search)
+{
+    /* Rescored candidates are only compared among themselves, so before
+     * the first one is rescored, fall back to the best base score. */
+    if (search->chosen == NULL)
     {
-        if ((ct.value >> (h - 1)) & 0x1)
-            return h;
+        for (int b = 0; b < search->num_buckets; b++)
+        {
+            const AICandidate* candidate = &search->best[b][0];
+            if (search->num_best[b] > 0 &&
+                (search->chosen == NULL ||
+                 ai_ranks_before(candidate->score, candidate->mask, search->chosen)))
+                search->chosen = candidate;
+        }
     }
 
-    return NONE;
+    search->walk_done = true;
+    search->done      = true;
+}
+
+/* Runs the search for at most budget_cycles, or to the end with
+ * AI_SEARCH_BUDGET_UNLIMITED, within what is left of the level's decision
+ * budget. With walk_only the rescoring is left for later, see
+ * ai_precompute_step(). Returns true once the search, or the walk, is done. */
+static bool ai_search_run(AISearch* search, u32 budget_cycles, bool walk_only)
+{
+    if (search->done || (walk_only && search->walk_done))
+        return true;
+
+    if (budget_cycles > search->cycles_left)
+        budget_cycles = search->cycles_left;
+
+    ai_timer_start();
+
+    /* At least one step is taken per call so every call makes progress, the
+     * budget is overrun by at most one step. */
+    do
+    {
+        if (!search->walk_done)
+            ai_search_walk_step(search);
+        else
+            ai_search_rescore_step(search);
+    } while (!search->done && !(walk_only && search->walk_done) &&
+             ai_timer_cycles() < budget_cycles);
+
+    u32 elapsed = ai_timer_cycles();
+    ai_timer_stop();
+
+    search->cycles_left -= (elapsed < search->cycles_left) ? elapsed : search->cycles_left;
+    if (search->cycles_left == 0 && !search->done)
+        ai_search_cut(search);
+
+    return search->done || (walk_only && search->walk_done);
+}
+
+static int ai_search_result(const AISearch* search, bool* out_sel,
+                            enum HandType* out_hand_type)
+{
+    const AICandidate* chosen = search->chosen;
+
+    for (int i = 0; i < search->count; i++)
+        out_sel[i] = chosen && (chosen->mask & (1u << i)) != 0;
+
+    if (out_hand_type) *out_hand_type = chosen ? chosen->ht : NONE;
+    return chosen ? chosen->count : 0;
 }
 
 /* -----------------------------------------------------------------------
- * Score estimate for a card combination.
+ * Discard planner.
  *
- * Used only for comparison during AI hand selection; does NOT modify any
- * global game state.
+ * A handful of keep sets are built from the hand: the best hand found by
+ * the search, the largest N of a kind, the largest suit and the best
+ * straight window. Discarding the rest of each is tried against random
+ * refills drawn from the remaining deck. Each refilled hand is scored the
+ * way the hand search would play it, and the discard with the best average
+ * wins if it clears keeping the current hand by AI_PLANNER_MIN_GAIN_PERCENT.
+ *
+ * Like the hand search, the decision is taken a step at a time so the game
+ * loop can spread it over frames, see ai_discard_step().
  * ----------------------------------------------------------------------- */
-static u32 ai_score_combo(Card** cards, int count)
+
+/* Keep sets tried: best hand, N of a kind, suit, straight window. */
+#define AI_PLANNER_MAX_CANDIDATES 4
+
+/* xorshift32, kept apart from rand() so planning never changes the game's
+ * random sequence. Any non-zero seed works. */
+#define AI_PLANNER_RNG_SEED 0x2545F491u
+
+static u32 ai_planner_rng_state = AI_PLANNER_RNG_SEED;
+
+static inline u32 ai_planner_rand(void)
 {
-    enum HandType ht = ai_compute_hand_type(cards, count);
-    if (ht == NONE)
-        return 0;
+    u32 x = ai_planner_rng_state;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    ai_planner_rng_state = x;
+    return x;
+}
 
-    u32 c = ai_hand_base[ht].chips;
-    u32 m = ai_hand_base[ht].mult;
+/* Turns a keep mask into a discard mask of at most MAX_SELECTION_SIZE
+ * cards, dropping the lowest chip values first. */
+static u32 ai_planner_discard_mask(Card** hand, int count, u32 keep_mask)
+{
+    u32 discard_mask = ~keep_mask & ((1u << count) - 1);
+
+    while (__builtin_popcount(discard_mask) > MAX_SELECTION_SIZE)
+    {
+        /* Keep the highest value card of the discard instead. */
+        int highest = -1;
+        for (int i = 0; i < count; i++)
+        {
+            if ((discard_mask & (1u << i)) &&
+                (highest < 0 || card_get_value(hand[i]) > card_get_value(hand[highest])))
+                highest = i;
+        }
+        discard_mask &= ~(1u << highest);
+    }
+
+    return discard_mask;
+}
+
+/* Keep mask of the cards whose rank is in rank_mask, one card per rank. */
+static u32 ai_planner_keep_ranks(Card** hand, int count, u16 rank_mask)
+{
+    u32 keep_mask = 0;
 
-    /* Add chip value of each played card (mirrors PLAY_SCORING_CARDS). */
     for (int i = 0; i < count; i++)
     {
-        if (cards[i])
-            c += card_get_value(cards[i]);
+        u16 rank_bit = 1 << hand[i]->rank;
+        if (rank_mask & rank_bit)
+        {
+            keep_mask |= 1u << i;
+            rank_mask &= ~rank_bit;
+        }
     }
 
-    /* Guard against 32-bit overflow (mirrors u32_protected_mult in game.c). */
-    if (c == 0 || m == 0)
+    return keep_mask;
+}
+
+static int ai_planner_candidates(
+    Card** hand,
+    int count,
+    const bool* best_sel,
+    const RuleSet* rules,
+    const DeckComposition* remaining,
+    u32* out_discard_masks
+)
+{
+    HandBitboard all;
+    hand_bitboard_from_cards(&all, hand, count);
+
+    u32  keep[AI_PLANNER_MAX_CANDIDATES]      = {0};
+    bool reachable[AI_PLANNER_MAX_CANDIDATES] = {true, true, true, true};
+
+    for (int i = 0; i < count; i++)
+    {
+        if (best_sel[i])
+            keep[0] |= 1u << i;
+    }
+
+    /* Largest N of a kind, highest rank on ties. */
+    u8  max_count = rank_hist_max_count(all.rank_counts);
+    u16 max_ranks = rank_hist_ranks_at_least(all.rank_counts, max_count);
+    int kind_rank = 31 - __builtin_clz(max_ranks);
+
+    /* Largest suit, lowest suit on ties. */
+    int flush_suit = 0;
+    for (int suit = 1; suit < NUM_SUITS; suit++)
+    {
+        if (hand_bitboard_suit_count(&all, suit) > hand_bitboard_suit_count(&all, flush_suit))
+            flush_suit = suit;
+    }
+
+    for (int i = 0; i < count; i++)
+    {
+        if (hand[i]->rank == kind_rank)
+            keep[1] |= 1u << i;
+        if (hand[i]->suit == flush_suit)
+            keep[2] |= 1u << i;
+    }
+
+    /* Not worth sampling a flush draw the deck can't complete. Smeared
+     * suits would need both suits of a colour counted, left to sampling. */
+    if (remaining != NULL && !rules->smeared &&
+        hand_bitboard_suit_count(&all, flush_suit) + deck_comp_suit_count(remaining, flush_suit) <
+            rules->straight_size)
+        reachable[2] = false;
+
+    /* Straight window holding the most ranks, the higher window on ties. In
+     * the extended mask bit 0 is the ace played low and bit r + 1 is rank r. */
+    u32 extended   = ((u32)all.rank_mask << 1) | ((all.rank_mask >> ACE) & 0x1);
+    u32 window     = (1u << rules->straight_size) - 1;
+    u16 best_ranks  = 0;
+    u16 best_window = 0;
+    int best_held   = 0;
+    for (int low = 0; low + rules->straight_size <= NUM_RANKS + 1; low++)
+    {
+        u32 held     = extended & (window << low);
+        int num_held = __builtin_popcount(held);
+        if (num_held >= best_held)
+        {
+            best_held   = num_held;
+            best_ranks  = (held >> 1) | ((held & 0x1) << ACE);
+            best_window = ((window << low) >> 1) | (((window << low) & 0x1) << ACE);
+        }
+    }
+    keep[3] = ai_planner_keep_ranks(hand, count, best_ranks);
+
+    /* Same for a straight draw missing a rank the deck has run out of, unless
+     * Shortcut lets the straight skip it. */
+    if (remaining != NULL && !rules->shortcut &&
+        (best_window & ~best_ranks & ~deck_comp_rank_mask(remaining)) != 0)
+        reachable[3] = false;
+
+    /* Drop the keep sets that lead to the same discard as an earlier one. */
+    int num_candidates = 0;
+    for (int c = 0; c < AI_PLANNER_MAX_CANDIDATES; c++)
+    {
+        if (!reachable[c])
+            continue;
+
+        u32 discard_mask = ai_planner_discard_mask(hand, count, keep[c]);
+        bool duplicate   = discard_mask == 0;
+
+        for (int k = 0; k < num_candidates && !duplicate; k++)
+            duplicate = out_discard_masks[k] == discard_mask;
+
+        if (!duplicate)
+            out_discard_masks[num_candidates++] = discard_mask;
+    }
+
+    return num_candidates;
+}
+
+/* Scratch search the refills are scored with. Static like
+ * ai_background_search, but apart from it so planning never drops a search
+ * the game loop is still stepping. */
+static AISearch ai_planner_search;
+
+/* One discard decision. The hand as it is is scored first, then every
+ * candidate gets one refill per round. Each is scored like the hand search
+ * would play it, by walking ai_planner_search one step at a time, so the
+ * decision can stop after any step and pick up on the next frame. */
+typedef struct
+{
+    Card* hand[MAX_HAND_SIZE];
+    int   count;
+
+    /* Scratch copy of the deck the refills are drawn from with partial
+     * Fisher-Yates shuffles, never restored since any order is as good as
+     * another. */
+    Card* pool[MAX_DECK_SIZE];
+    int   deck_count;
+
+    /* The discards tried, and the cards each keeps with room after them
+     * for the refill. */
+    u32   discard_masks[AI_PLANNER_MAX_CANDIDATES];
+    int   num_candidates;
+    Card* kept[AI_PLANNER_MAX_CANDIDATES][MAX_HAND_SIZE];
+    int   num_kept[AI_PLANNER_MAX_CANDIDATES];
+
+    /* Summed scores of the refills sampled so far, and their number. */
+    u32   totals[AI_PLANNER_MAX_CANDIDATES];
+    int   num_samples[AI_PLANNER_MAX_CANDIDATES];
+    int   samples;
+
+    /* Score of the hand as it is, once current_scored. */
+    u32   current;
+    bool  current_scored;
+
+    /* Candidate sampled next, and whether ai_planner_search is still
+     * scoring a hand. */
+    int   next_candidate;
+    bool  searching;
+
+    /* Levels that don't sample decide up front, see ai_discard_begin(). */
+    bool  sampling;
+    u32   fixed_mask;
+
+    /* What is left of the decision's budget, see ai_planner_run(). */
+    u32   cycles_left;
+    bool  done;
+} AIPlanner;
+
+static void ai_planner_init(
+    AIPlanner* planner,
+    Card** hand,
+    int count,
+    const bool* best_sel,
+    Card** deck,
+    int deck_count,
+    const DeckComposition* remaining,
+    int samples,
+    u32 budget_cycles
+)
+{
+    if (count > MAX_HAND_SIZE)
+        count = MAX_HAND_SIZE;
+    if (count < 0)
+        count = 0;
+    if (deck_count > MAX_DECK_SIZE)
+        deck_count = MAX_DECK_SIZE;
+
+    for (int i = 0; i < count; i++)
+        planner->hand[i] = hand[i];
+    for (int i = 0; i < deck_count; i++)
+        planner->pool[i] = deck[i];
+
+    planner->count          = count;
+    planner->deck_count     = deck_count;
+    planner->num_candidates = 0;
+    planner->samples        = samples;
+    planner->current        = 0;
+    planner->current_scored = false;
+    planner->next_candidate = 0;
+    planner->searching      = false;
+    planner->sampling       = true;
+    planner->fixed_mask     = 0;
+    planner->cycles_left    = budget_cycles;
+    planner->done           = true;
+
+    if (count == 0 || deck_count <= 0 || samples <= 0 || budget_cycles == 0)
+        return;
+
+    planner->num_candidates = ai_planner_candidates(
+        hand,
+        count,
+        best_sel,
+        get_rule_set(),
+        remaining,
+        planner->discard_masks
+    );
+    if (planner->num_candidates == 0)
+        return;
+
+    for (int c = 0; c < planner->num_candidates; c++)
+    {
+        planner->num_kept[c]    = 0;
+        planner->totals[c]      = 0;
+        planner->num_samples[c] = 0;
+    }
+
+    for (int i = 0; i < count; i++)
+    {
+        for (int c = 0; c < planner->num_candidates; c++)
+        {
+            if (!(planner->discard_masks[c] & (1u << i)))
+                planner->kept[c][planner->num_kept[c]++] = hand[i];
+        }
+    }
+
+    planner->done = false;
+}
+
+/* Starts scoring the next hand: the hand as it is, then a refill of the
+ * next candidate. */
+static void ai_planner_start_sample(AIPlanner* planner)
+{
+    if (!planner->current_scored)
+    {
+        ai_search_init(&ai_planner_search, planner->hand, planner->count);
+        return;
+    }
+
+    int c     = planner->next_candidate;
+    int draws = __builtin_popcount(planner->discard_masks[c]);
+    if (draws > planner->deck_count)
+        draws = planner->deck_count;
+
+    for (int k = 0; k < draws; k++)
+    {
+        int   j   = k + ai_planner_rand() % (planner->deck_count - k);
+        Card* tmp = planner->pool[k];
+        planner->pool[k] = planner->pool[j];
+        planner->pool[j] = tmp;
+        planner->kept[c][planner->num_kept[c] + k] = planner->pool[k];
+    }
+
+    ai_search_init(&ai_planner_search, planner->kept[c], planner->num_kept[c] + draws);
+}
+
+/* Takes the score of the hand ai_planner_search has finished with. */
+static void ai_planner_end_sample(AIPlanner* planner)
+{
+    const AISearch* search = &ai_planner_search;
+    u32             score  = 0;
+
+    if (search->chosen != NULL)
+        score = search->use_jokers ? search->chosen_score : search->chosen->score;
+
+    if (!planner->current_scored)
+    {
+        planner->current        = score;
+        planner->current_scored = true;
+        return;
+    }
+
+    int c = planner->next_candidate;
+    planner->totals[c] = u32_protected_add(planner->totals[c], score);
+    planner->num_samples[c]++;
+
+    planner->next_candidate = (c + 1) % planner->num_candidates;
+    if (planner->next_candidate == 0 && planner->num_samples[0] >= planner->samples)
+        planner->done = true;
+}
+
+/* Takes one step of the search scoring the current sample. */
+static void ai_planner_step(AIPlanner* planner)
+{
+    AISearch* search = &ai_planner_search;
+
+    if (!planner->searching)
+    {
+        ai_planner_start_sample(planner);
+        planner->searching = true;
+    }
+    else if (!search->walk_done)
+    {
+        ai_search_walk_step(search);
+    }
+    else if (!search->done)
+    {
+        ai_search_rescore_step(search);
+    }
+    else
+    {
+        ai_planner_end_sample(planner);
+        planner->searching = false;
+    }
+}
+
+/* Runs the decision for at most budget_cycles, within what is left of its
+ * own budget, like ai_search_run(). Once that is spent the sample being
+ * scored is dropped and the decision is made from the ones already scored.
+ * Returns true once the decision is made. */
+static bool ai_planner_run(AIPlanner* planner, u32 budget_cycles)
+{
+    if (planner->done)
+        return true;
+
+    if (budget_cycles > planner->cycles_left)
+        budget_cycles = planner->cycles_left;
+
+    ai_timer_start();
+
+    do
+    {
+        ai_planner_step(planner);
+    } while (!planner->done && ai_timer_cycles() < budget_cycles);
+
+    u32 elapsed = ai_timer_cycles();
+    ai_timer_stop();
+
+    planner->cycles_left -= (elapsed < planner->cycles_left) ? elapsed : planner->cycles_left;
+    if (planner->cycles_left == 0)
+        planner->done = true;
+
+    return planner->done;
+}
+
+/* Mask of the cards to discard, 0 to play the hand as it is. */
+static u32 ai_planner_result(const AIPlanner* planner)
+{
+    if (!planner->sampling)
+        return planner->fixed_mask;
+    if (!planner->current_scored)
         return 0;
-    if (c > 0xFFFFFFFF / m)
-        return 0xFFFFFFFF;
 
-    return c * m;
+    /* Discarding has to beat the hand as it is by a margin: the best of a
+     * few averages over a few samples each is an optimistic estimate, while
+     * a hand played now is a sure score. Averages are compared by cross
+     * multiplying, a decision cut short leaves the first candidates with
+     * one sample more than the others. */
+    int best = -1;
+    for (int c = 0; c < planner->num_candidates; c++)
+    {
+        u64 n = planner->num_samples[c];
+        if (n == 0 ||
+            (u64)planner->totals[c] * 100 <=
+                (u64)planner->current * n * (100 + AI_PLANNER_MIN_GAIN_PERCENT))
+            continue;
+
+        if (best < 0 ||
+            (u64)planner->totals[c] * planner->num_samples[best] > (u64)planner->totals[best] * n)
+            best = c;
+    }
+
+    return (best < 0) ? 0 : planner->discard_masks[best];
+}
+
+static int ai_planner_output(const AIPlanner* planner, bool* out_discard)
+{
+    u32 mask = ai_planner_result(planner);
+
+    for (int i = 0; i < planner->count; i++)
+        out_discard[i] = (mask & (1u << i)) != 0;
+
+    return __builtin_popcount(mask);
 }
 
 /* -----------------------------------------------------------------------
  * Public API
  * ----------------------------------------------------------------------- */
 
+void ai_set_level(enum AILevel level)
+{
+    if (level < 0 || level >= AI_NUM_LEVELS)
+        level = AI_LEVEL_GREEDY;
+
+    ai_level_id = level;
+    ai_level    = &ai_level_infos[level];
+}
+
+enum AILevel ai_get_level(void)
+{
+    return ai_level_id;
+}
+
+const AILevelInfo* ai_get_level_info(enum AILevel level)
+{
+    if (level < 0 || level >= AI_NUM_LEVELS)
+        return NULL;
+
+    return &ai_level_infos[level];
+}
+
+/* The search spread over frames by the game loop. Static rather than on the
+ * stack: it outlives the frame that started it. */
+static AISearch ai_background_search;
+
+/* What the last hand search to return a hand left of the level's decision
+ * budget, the discard decision that follows spends the rest of it. */
+static u32 ai_decision_cycles_left = 0;
+
+/* The search walked ahead of time by ai_precompute_step(). */
+static AISearch ai_precomputed_search;
+static bool     ai_precomputed = false;
+
+/* Returns true if the precomputed walk is still valid for these cards. */
+static bool ai_precompute_matches(Card** hand, int count)
+{
+    const AISearch* search = &ai_precomputed_search;
+    const RuleSet*  rules  = get_rule_set();
+
+    if (!ai_precomputed || search->count != count || search->level != ai_level)
+        return false;
+
+    for (int i = 0; i < count; i++)
+    {
+        if (search->hand[i] != hand[i])
+            return false;
+    }
+
+    /* Owning a first joker or selling the last one changes how the best
+     * subsets are kept, the other joker changes only matter through the
+     * rules. */
+    bool use_jokers = ai_level->joker_aware && list_get_len(get_jokers_list()) > 0;
+
+    return search->use_jokers == use_jokers &&
+           search->rules.straight_size == rules->straight_size &&
+           search->rules.shortcut == rules->shortcut &&
+           search->rules.smeared == rules->smeared &&
+           search->rules.mobius_wrap == rules->mobius_wrap &&
+           search->rules.legacy_wrap == rules->legacy_wrap &&
+           search->rules.pareidolia == rules->pareidolia &&
+           search->rules.face_rank_mask == rules->face_rank_mask;
+}
+
 int ai_select_best_hand(Card** hand, int count, bool* out_sel,
                         enum HandType* out_hand_type)
 {
-    if (count <= 0)
+    AISearch search;
+
+    ai_search_init(&search, hand, count);
+
+    /* With 16 cards there are 6,884 subsets of 1..5 cards instead of the
+     * 65,536 masks, most of them pruned once the seed is in place. */
+    ai_search_run(&search, AI_SEARCH_BUDGET_UNLIMITED, false);
+
+    ai_decision_cycles_left = search.cycles_left;
+    return ai_search_result(&search, out_sel, out_hand_type);
+}
+
+void ai_search_begin(Card** hand, int count)
+{
+    if (ai_precompute_matches(hand, count))
     {
-        if (out_hand_type) *out_hand_type = NONE;
-        return 0;
+        /* The walk only depends on the cards and the rules, the rescoring
+         * reads the jokers' state, which may have changed since, so it is
+         * redone. Idle time didn't count towards the decision budget. */
+        ai_background_search              = ai_precomputed_search;
+        ai_background_search.num_rescored = 0;
+        ai_background_search.chosen       = NULL;
+        ai_background_search.chosen_score = 0;
+        ai_background_search.done         = false;
+        ai_background_search.cycles_left  = ai_level->decision_budget_cycles;
+        ai_precomputed = false;
+        return;
     }
 
-    for (int i = 0; i < count; i++)
-        out_sel[i] = false;
+    ai_search_init(&ai_background_search, hand, count);
+}
 
-    /* Limit to MAX_SELECTION_SIZE cards and to what is actually available. */
-    int max_sel = (count < MAX_SELECTION_SIZE) ? count : MAX_SELECTION_SIZE;
+bool ai_search_step(u32 budget_cycles)
+{
+    return ai_search_run(&ai_background_search, budget_cycles, false);
+}
+
+void ai_planner_seed(u32 seed)
+{
+    /* xorshift32 never leaves zero. */
+    ai_planner_rng_state = (seed != 0) ? seed : AI_PLANNER_RNG_SEED;
+}
+
+void ai_score_cache_clear(void)
+{
+    for (int i = 0; i < AI_SCORE_CACHE_NUM_ENTRIES; i++)
+        ai_score_cache[i].key = 0;
+}
+
+void ai_precompute_begin(Card** hand, int count)
+{
+    ai_search_init(&ai_precomputed_search, hand, count);
+    ai_precomputed = true;
+}
 
-    u32           best_score = 0;
-    int           best_mask  = 0;
-    int           best_count = 0;
-    enum HandType best_ht    = NONE;
+bool ai_precompute_step(u32 budget_cycles)
+{
+    if (!ai_precomputed)
+        return true;
+
+    return ai_search_run(&ai_precomputed_search, budget_cycles, true);
+}
+
+void ai_precompute_clear(void)
+{
+    ai_precomputed = false;
+}
 
-    /* Enumerate every non-empty subset by bitmask.
-     * count <= AI_HAND_SIZE (8) so the limit is at most 255 iterations. */
-    int limit = 1 << count;
+int ai_search_finish(bool* out_sel, enum HandType* out_hand_type)
+{
+    ai_search_run(&ai_background_search, AI_SEARCH_BUDGET_UNLIMITED, false);
 
-    Card* combo[MAX_SELECTION_SIZE];
+    ai_decision_cycles_left = ai_background_search.cycles_left;
+    return ai_search_result(&ai_background_search, out_sel, out_hand_type);
+}
 
-    for (int mask = 1; mask < limit; mask++)
+int ai_plan_discard(
+    Card** hand,
+    int count,
+    const bool* best_sel,
+    Card** deck,
+    int deck_count,
+    const DeckComposition* remaining,
+    int samples,
+    u32 budget_cycles,
+    bool* out_discard
+)
+{
+    AIPlanner planner;
+
+    ai_planner_init(
+        &planner,
+        hand,
+        count,
+        best_sel,
+        deck,
+        deck_count,
+        remaining,
+        samples,
+        budget_cycles
+    );
+    ai_planner_run(&planner, AI_SEARCH_BUDGET_UNLIMITED);
+
+    return ai_planner_output(&planner, out_discard);
+}
+
+/* The discard decision spread over frames by the game loop. */
+static AIPlanner ai_discard_planner;
+
+void ai_discard_begin(
+    Card** hand,
+    int count,
+    const bool* best_sel,
+    enum HandType best_hand_type,
+    int discards_taken,
+    Card** deck,
+    int deck_count,
+    const DeckComposition* remaining
+)
+{
+    AIPlanner* planner = &ai_discard_planner;
+
+    if (ai_level->planner_samples > 0)
     {
-        /* Count bits (Kernighan method). */
-        int n   = 0;
-        int tmp = mask;
-        while (tmp) { n += tmp & 1; tmp >>= 1; }
+        ai_planner_init(
+            planner,
+            hand,
+            count,
+            best_sel,
+            deck,
+            deck_count,
+            remaining,
+            ai_level->planner_samples,
+            ai_decision_cycles_left
+        );
+        return;
+    }
 
-        if (n > max_sel)
-            continue;
+    if (count > MAX_HAND_SIZE)
+        count = MAX_HAND_SIZE;
+    if (count < 0)
+        count = 0;
 
-        /* Build the combo array for this subset. */
-        int ci = 0;
-        for (int i = 0; i < count && ci < MAX_SELECTION_SIZE; i++)
-        {
-            if (mask & (1 << i))
-                combo[ci++] = hand[i];
-        }
+    planner->count      = count;
+    planner->sampling   = false;
+    planner->fixed_mask = 0;
+    planner->done       = true;
 
-        u32 s = ai_score_combo(combo, n);
+    /* Without sampling, the first discard chases anything below a straight
+     * and a later one only a hand still below two pair. */
+    enum HandType threshold = (discards_taken == 0) ? STRAIGHT : TWO_PAIR;
+    if (best_hand_type >= threshold)
+        return;
 
-        if (s > best_score)
+    /* Every leftover card goes, up to the per-action card limit. */
+    int discard_count = 0;
+    for (int i = 0; i < count && discard_count < MAX_SELECTION_SIZE; i++)
+    {
+        if (!best_sel[i])
         {
-            best_score = s;
-            best_mask  = mask;
-            best_count = n;
-            best_ht    = ai_compute_hand_type(combo, n);
+            planner->fixed_mask |= 1u << i;
+            discard_count++;
         }
     }
+}
 
-    /* Commit the winning selection. */
-    for (int i = 0; i < count; i++)
-        out_sel[i] = (best_mask & (1 << i)) != 0;
+bool ai_discard_step(u32 budget_cycles)
+{
+    return ai_planner_run(&ai_discard_planner, budget_cycles);
+}
 
-    if (out_hand_type) *out_hand_type = best_ht;
-    return best_count;
+int ai_discard_finish(bool* out_discard)
+{
+    ai_planner_run(&ai_discard_planner, AI_SEARCH_BUDGET_UNLIMITED);
+    return ai_planner_output(&ai_discard_planner, out_discard);
+}
+
+int ai_choose_discard(
+    Card** hand,
+    int count,
+    const bool* best_sel,
+    enum HandType best_hand_type,
+    int discards_taken,
+    Card** deck,
+    int deck_count,
+    const DeckComposition* remaining,
+    bool* out_discard
+)
+{
+    ai_discard_begin(
+        hand,
+        count,
+        best_sel,
+        best_hand_type,
+        discards_taken,
+        deck,
+        deck_count,
+        remaining
+    );
+    return ai_discard_finish(out_discard);
 }
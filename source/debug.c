@@ -11,6 +11,7 @@
  *   SELECT + A     : Add $100 to current money
  *   SELECT + DOWN  : Win current round (set score >= blind requirement)
  *   SELECT + L     : Add +1 hand and +1 discard
+ *   SELECT + R     : Reset the hand memo hit/miss counters
  *
  * Compile-time only (in debug.h):
  *   DEBUG_START_MONEY    : Override starting money
@@ -24,6 +25,7 @@
 #include "game.h"
 #include "joker.h"
 #include "graphic_utils.h"
+#include "hand_memo.h"
 #include "blind.h"
 #include "list.h"
 #include "util.h"
@@ -45,9 +47,9 @@ static int  picker_scroll_top = 0;
 static bool picker_needs_redraw = false;
 
 /* Number of visible rows in the picker (GBA screen = 160px, 8px per row,
- * reserve 2 rows for header/footer) */
+ * reserve 3 rows for the header) */
 #define PICKER_VISIBLE_ROWS 16
-#define PICKER_HEADER_ROWS  2
+#define PICKER_HEADER_ROWS  3
 #define PICKER_BODY_ROWS    (PICKER_VISIBLE_ROWS - PICKER_HEADER_ROWS)
 
 /* Debounce: prevent repeated triggers while key is held */
@@ -201,6 +203,13 @@ static void debug_draw_picker(void)
         4, 8, TTE_YELLOW_PB
     );
 
+    /* Hand evaluation memo counters, see hand_memo.h */
+    const HandMemoStats* memo_stats = hand_memo_get_stats();
+    tte_printf(
+        "#{P:%d,%d; cx:0x%X000}MEMO HIT:%u MISS:%u",
+        4, 16, TTE_BLUE_PB, (unsigned)memo_stats->hits, (unsigned)memo_stats->misses
+    );
+
     /* Body: list of jokers */
     int y = PICKER_HEADER_ROWS * 8;
     for (int i = 0; i < PICKER_BODY_ROWS; i++)
@@ -257,8 +266,8 @@ static void debug_picker_add_joker(int joker_id)
     joker_object->sprite_object->tx = int2fx(108);
     joker_object->sprite_object->ty = int2fx(10);
 
-    /* Use the public list interface to add */
-    list_push_back(jokers_list, joker_object);
+    /* Go through the game so the joker counts and rule set stay in sync */
+    add_owned_joker(joker_object);
 }
 
 /* ========================================================================
@@ -420,6 +429,12 @@ void debug_on_game_update(void)
         set_num_discards_remaining(get_num_discards_remaining() + 1);
     }
 
+    /* SELECT + R : Reset the hand memo counters shown in the picker */
+    if (keys_hit & KEY_R)
+    {
+        hand_memo_reset_stats();
+    }
+
     prev_keys = keys_now;
 }
 
@@ -14,6 +14,7 @@
 #include "card.h"
 #include "graphic_utils.h"
 #include "hand_analysis.h"
+#include "hand_memo.h"
 #include "joker.h"
 #include "list.h"
 #include "selection_grid.h"
@@ -27,8 +28,6 @@
 #include <stdint.h>
 #include <stdlib.h>
 #include <limits.h>
-#define STRAIGHT_AND_FLUSH_SIZE_FOUR_FINGERS 4
-#define STRAIGHT_AND_FLUSH_SIZE_DEFAULT      5
 
 // Pixel sizes
 #define ITEM_SHOP_Y               71
@@ -186,13 +185,6 @@ enum BlindSelectStates
     BLIND_SELECT_MAX
 };
 
-typedef struct
-{
-    u32 chips;
-    u32 mult;
-    char* display_name;
-} HandValues;
-
 // Used as a No Operation for game states that have no init and/or exit function.
 // ricfehr3 did the work of determining whether a noop or a NULL check was more
 // efficient. Well, this is the answer.
@@ -228,6 +220,7 @@ static void game_score_compare_on_init(void);
 static void game_score_compare_on_update(void);
 static void game_score_compare_on_exit(void);
 static void game_shop_intro(void);
+static void on_owned_jokers_changed(void);
 static void game_shop_process_user_input(void);
 static void game_shop_outro(void);
 static void game_blind_select_start_anim_seq(void);
@@ -262,7 +255,7 @@ static int deck_get_max_size(void);
 static void increment_blind(enum BlindState increment_reason);
 static void game_over_init(void);
 static bool check_and_score_joker_for_event(
-    ListItr* starting_joker_itr,
+    int* joker_idx,
     CardObject* card_object,
     enum JokerEvent joker_event
 );
@@ -278,6 +271,7 @@ static void game_playing_sort_by_suit_on_pressed(void);
 // AI-vs-player mod helpers
 static void game_ai_turn_start(void);
 static void game_ai_turn_end(void);
+static void ai_think(void);
 static void ai_auto_play(void);
 
 static int game_playing_button_row_get_size(void);
@@ -525,23 +519,6 @@ SelectionGrid shop_selection_grid = {
 static const int HAND_SPACING_LUT[MAX_HAND_SIZE] =
     {28, 28, 28, 28, 27, 21, 18, 15, 13, 12, 10, 9, 9, 8, 8, 7};
 
-static const HandValues hand_base_values[] = {
-    {.chips = 0,   .mult = 0,  .display_name = NULL     }, // NONE
-    {.chips = 5,   .mult = 1,  .display_name = "HIGH C" }, // HIGH_CARD
-    {.chips = 10,  .mult = 2,  .display_name = "PAIR"   }, // PAIR
-    {.chips = 20,  .mult = 2,  .display_name = "2 PAIR" }, // TWO_PAIR
-    {.chips = 30,  .mult = 3,  .display_name = "3 OAK"  }, // THREE_OF_A_KIND
-    {.chips = 30,  .mult = 4,  .display_name = "STRT"   }, // STRAIGHT
-    {.chips = 35,  .mult = 4,  .display_name = "FLUSH"  }, // FLUSH
-    {.chips = 40,  .mult = 4,  .display_name = "FULL H" }, // FULL_HOUSE
-    {.chips = 60,  .mult = 7,  .display_name = "4 OAK"  }, // FOUR_OF_A_KIND
-    {.chips = 100, .mult = 8,  .display_name = "STRT F" }, // STRAIGHT_FLUSH
-    {.chips = 100, .mult = 8,  .display_name = "ROYAL F"}, // ROYAL_FLUSH
-    {.chips = 120, .mult = 12, .display_name = "5 OAK"  }, // FIVE_OF_A_KIND
-    {.chips = 140, .mult = 14, .display_name = "FLUSH H"}, // FLUSH_HOUSE
-    {.chips = 160, .mult = 16, .display_name = "FLUSH 5"}  // FLUSH_FIVE
-};
-
 static const SubStateActionFn shop_state_actions[] = {
     game_shop_intro,
     game_shop_process_user_input,
@@ -576,6 +553,8 @@ static enum PlayState play_state = PLAY_STARTING;
 
 static enum HandType hand_type = NONE;
 static ContainedHandTypes _contained_hands = {0};
+// Hand reported by the scoring getters instead of the played one, see game_set_score_preview()
+static ScorePreview* _score_preview = NULL;
 
 static CardObject* main_menu_ace = NULL;
 
@@ -628,10 +607,27 @@ static bool ai_is_playing = false;
 // after each play action).  Capped at AI_MAX_DISCARDS_PER_CYCLE.
 #define AI_MAX_DISCARDS_PER_CYCLE 2
 static int  ai_discard_cycle_count = 0;
+// Compact copy of the AI's hand the background search runs on, see ai_think().
+// hand[] may have NULL gaps if cards were discarded, so it is compressed.
+static Card* ai_hand_cards[MAX_HAND_SIZE];
+static int   ai_card_idx_map[MAX_HAND_SIZE]; // maps compact idx → hand[] index
+static int   ai_hand_size = 0;
+static bool  ai_search_started = false;
+// Whether the discard decision that follows the search was started, and whether the AI was allowed
+// to discard at all, see ai_think()
+static bool  ai_discard_started = false;
+static bool  ai_discard_pending = false;
 static u32 player_round_score = 0;
 static u32 ai_round_score = 0;
 static Card   _ai_cards[MAX_DECK_SIZE];
 static bool   _ai_cards_initialized = false;
+// The AI deck is shuffled ahead of its turn so its opening hand is known during the player's
+// turn, see ai_deck_prepare() and ai_precompute_idle()
+static Card*  _ai_deck_order[MAX_DECK_SIZE];
+static bool   _ai_deck_order_ready = false;
+static Card*  ai_opening_hand[MAX_HAND_SIZE];
+static int    ai_opening_hand_size = 0;
+static bool   ai_precompute_started = false;
 static Card* _player_deck_save[MAX_DECK_SIZE];
 static int    _player_deck_save_top = -1;
 static u32 chips = 0;
@@ -641,6 +637,8 @@ static bool retrigger = false;
 static int hand_size = 8; // Default hand size is 8
 static int cards_drawn = 0;
 static int hand_selections = 0;
+// Live bitboard of the selected cards in hand[], updated together with hand_selections
+static HandBitboard hand_selection_bb = {0};
 
 // Keeping track of cards scored
 static int scored_card_index = 0;
@@ -650,9 +648,11 @@ static bool sound_played = false;
 static bool discarded_card = false;
 
 // Keeping track of what Jokers are scored at each step
-static ListItr _joker_scored_itr;
-static ListItr _joker_card_scored_end_itr;
-static ListItr _joker_round_end_itr;
+// Positions of the scoring passes in the subscribers of the event they score,
+// see check_and_score_joker_for_event()
+static int _joker_scored_idx;
+static int _joker_card_scored_end_idx;
+static int _joker_round_end_idx;
 
 static int selection_x = 0;
 static int selection_y = 0;
@@ -675,14 +675,24 @@ static int hand_top = -1;
 
 static Card* deck[MAX_DECK_SIZE] = {NULL};
 static int deck_top = -1;
+// Composition of deck[], kept in sync by deck_push() and deck_pop(). Code writing deck[]
+// directly must rebuild it with deck_comp_from_cards()
+static DeckComposition deck_composition = {0};
 
 static Card* discard_pile[MAX_DECK_SIZE] = {NULL};
 static int discard_top = -1;
 
-// Joker Special Variables
-static int shortcut_joker_count = 0;
-
-static int four_fingers_joker_count = 0;
+// Copies of each joker ID in _owned_jokers_list, kept in sync by add_owned_joker() and
+// remove_owned_joker() so that ownership checks never walk the list
+static u8 _owned_joker_counts[MAX_DEFINABLE_JOKERS] = {0};
+// Owned jokers whose effect reacts to each JokerEvent, in list order, so that the scoring loop
+// only visits the jokers concerned. Rebuilt by update_joker_event_subscribers()
+static JokerObject* _joker_event_subscribers[NUM_JOKER_EVENTS][MAX_ACTIVE_JOKERS];
+static u8 _joker_event_subscriber_counts[NUM_JOKER_EVENTS];
+// Rules derived from the owned jokers, rebuilt by update_rule_set() whenever they change
+static RuleSet _rule_set;
+// Hand evaluator specialized for _rule_set, swapped together with it
+static HandEvalFunc _hand_eval_func;
 
 GBAL_UNUSED
 static inline bool is_shop_joker_avail(int joker_id)
@@ -750,13 +760,16 @@ static inline void deck_push(Card* card)
     if (deck_top >= MAX_DECK_SIZE - 1)
         return;
     deck[++deck_top] = card;
+    deck_comp_add(&deck_composition, card);
 }
 
 static inline Card* deck_pop()
 {
     if (deck_top < 0)
         return NULL;
-    return deck[deck_top--];
+    Card* card = deck[deck_top--];
+    deck_comp_remove(&deck_composition, card);
+    return card;
 }
 
 static inline void discard_push(Card* card)
@@ -773,6 +786,32 @@ static inline Card* discard_pop()
     return discard_pile[discard_top--];
 }
 
+// Selects or deselects a card in the hand, keeping hand_selections and the selection bitboard in
+// sync so the hand type never needs to rescan hand[]
+static inline void hand_set_card_selected(CardObject* card_object, bool selected)
+{
+    if (card_object_is_selected(card_object) == selected)
+        return;
+
+    card_object_set_selected(card_object, selected);
+    if (selected)
+    {
+        hand_selections++;
+        hand_bitboard_add_card(&hand_selection_bb, card_object->card);
+    }
+    else
+    {
+        hand_selections--;
+        hand_bitboard_remove_card(&hand_selection_bb, card_object->card);
+    }
+}
+
+static inline void hand_clear_selections(void)
+{
+    hand_selections = 0;
+    hand_bitboard_clear(&hand_selection_bb);
+}
+
 static inline void jokers_available_to_shop_init(void)
 {
     reset_shop_jokers();
@@ -792,8 +831,9 @@ void game_init()
     _discarded_jokers_list = list_create();
     _expired_jokers_list = list_create();
     _shop_jokers_list = list_create();
+    on_owned_jokers_changed();
     // TODO: Move this to an initialization of the play scoring states
-    _joker_scored_itr = list_itr_create(&_owned_jokers_list);
+    _joker_scored_idx = 0;
 
     jokers_available_to_shop_init();
 
@@ -961,17 +1001,21 @@ void game_change_state(enum GameState new_game_state)
 
 CardObject** get_hand_array(void)
 {
+    if (_score_preview)
+        return _score_preview->held;
     return hand;
 }
 
 int get_hand_top(void)
 {
+    if (_score_preview)
+        return _score_preview->held_top;
     return hand_top;
 }
 
 int hand_get_size(void)
 {
-    return hand_top + 1;
+    return get_hand_top() + 1;
 }
 
 CardObject** get_played_array(void)
@@ -981,27 +1025,30 @@ CardObject** get_played_array(void)
 
 int get_played_top(void)
 {
+    if (_score_preview)
+        return _score_preview->played_top;
     return played_top;
 }
 
 int get_scored_card_index(void)
 {
+    if (_score_preview)
+        return _score_preview->scored_card_index;
     return scored_card_index;
 }
 
 bool is_joker_owned(int joker_id)
 {
-    ListItr itr = list_itr_create(&_owned_jokers_list);
-    JokerObject* joker;
+    return count_jokers_owned(joker_id) > 0;
+}
 
-    while ((joker = list_itr_next(&itr)))
+int count_jokers_owned(int joker_id)
+{
+    if (joker_id < 0 || joker_id >= MAX_DEFINABLE_JOKERS)
     {
-        if (joker->joker->id == joker_id)
-        {
-            return true;
-        }
+        return 0;
     }
-    return false;
+    return _owned_joker_counts[joker_id];
 }
 
 List* get_jokers_list(void)
@@ -1016,51 +1063,89 @@ List* get_expired_jokers_list(void)
 
 bool is_shortcut_joker_active(void)
 {
-    return shortcut_joker_count > 0;
+    return is_joker_owned(SHORTCUT_JOKER_ID);
+}
+
+bool is_four_fingers_joker_active(void)
+{
+    return is_joker_owned(FOUR_FINGERS_JOKER_ID);
 }
 
 int get_straight_and_flush_size(void)
 {
-    return four_fingers_joker_count > 0 ? STRAIGHT_AND_FLUSH_SIZE_FOUR_FINGERS
-                                        : STRAIGHT_AND_FLUSH_SIZE_DEFAULT;
+    return is_four_fingers_joker_active() ? STRAIGHT_AND_FLUSH_SIZE_FOUR_FINGERS
+                                          : STRAIGHT_AND_FLUSH_SIZE_DEFAULT;
 }
 
-static void add_joker(JokerObject* joker_object)
+const RuleSet* get_rule_set(void)
 {
-    list_push_back(&_owned_jokers_list, joker_object);
+    return &_rule_set;
+}
+
+const DeckComposition* get_deck_composition(void)
+{
+    return &deck_composition;
+}
 
-    // TODO: Extract to on_joker_added() callback
-    // In case the player gets multiple Four Fingers Jokers,
-    // only change size when the first one is added
-    if (joker_object->joker->id == FOUR_FINGERS_JOKER_ID)
+// Called by on_owned_jokers_changed()
+static void update_joker_event_subscribers(void)
+{
+    for (int joker_event = 0; joker_event < NUM_JOKER_EVENTS; joker_event++)
     {
-        four_fingers_joker_count++;
+        _joker_event_subscriber_counts[joker_event] = 0;
     }
 
-    if (joker_object->joker->id == SHORTCUT_JOKER_ID)
+    ListItr itr = list_itr_create(&_owned_jokers_list);
+    JokerObject* joker_object;
+    while ((joker_object = list_itr_next(&itr)))
     {
-        shortcut_joker_count++;
+        u16 event_mask = joker_get_event_mask(joker_object->joker);
+        for (int joker_event = 0; joker_event < NUM_JOKER_EVENTS; joker_event++)
+        {
+            u8* count = &_joker_event_subscriber_counts[joker_event];
+            if ((event_mask & JOKER_EVENT_BIT(joker_event)) && *count < MAX_ACTIVE_JOKERS)
+            {
+                _joker_event_subscribers[joker_event][(*count)++] = joker_object;
+            }
+        }
     }
 }
 
+// Called by on_owned_jokers_changed() so that hand evaluation never has to walk the list itself
+static void update_rule_set(void)
+{
+    joker_build_rule_set(&_rule_set);
+    _hand_eval_func = hand_eval_select_variant(&_rule_set);
+
+    // The AI's cached subset scores were computed under the previous jokers
+    ai_score_cache_clear();
+}
+
+// Rebuilds everything derived from _owned_jokers_list, call after any change to it
+static void on_owned_jokers_changed(void)
+{
+    update_rule_set();
+    // Subscribers depend on what the copying jokers copy, so resolve that first
+    joker_resolve_copy_targets(&_owned_jokers_list);
+    update_joker_event_subscribers();
+}
+
+void add_owned_joker(JokerObject* joker_object)
+{
+    list_push_back(&_owned_jokers_list, joker_object);
+    _owned_joker_counts[joker_object->joker->id]++;
+
+    on_owned_jokers_changed();
+}
+
 static void remove_owned_joker(int owned_joker_idx)
 {
-    // TODO: Extract to on_joker_removed() callback
     JokerObject* joker_object = list_get_at_idx(&_owned_jokers_list, owned_joker_idx);
-    // In case the player gets multiple Four Fingers Jokers,
-    // and only reset the size when all of them have been removed
-    if (joker_object->joker->id == FOUR_FINGERS_JOKER_ID)
-    {
-        four_fingers_joker_count--;
-    }
-
-    if (joker_object->joker->id == SHORTCUT_JOKER_ID)
-    {
-        shortcut_joker_count--;
-    }
+    _owned_joker_counts[joker_object->joker->id]--;
 
     set_shop_joker_avail(joker_object->joker->id, true);
     list_remove_at_idx(&_owned_jokers_list, owned_joker_idx);
+    on_owned_jokers_changed();
 }
 
 int get_deck_top(void)
@@ -1141,6 +1226,8 @@ void set_game_speed(int new_game_speed)
 
 u32 get_chips(void)
 {
+    if (_score_preview)
+        return _score_preview->chips;
     return chips;
 }
 
@@ -1151,6 +1238,8 @@ void set_chips(u32 new_chips)
 
 u32 get_mult(void)
 {
+    if (_score_preview)
+        return _score_preview->mult;
     return mult;
 }
 
@@ -1388,176 +1477,44 @@ static ContainedHandTypes compute_contained_hand_types(void)
         return hand_types;
     }
 
-    hand_types.HIGH_CARD = 1;
-
-    u8 suits[NUM_SUITS];
-    u8 ranks[NUM_RANKS];
-    get_hand_distribution(ranks, suits);
-
-    // The following can be optimized better but not sure how much it matters
-    u8 n_of_a_kind = hand_contains_n_of_a_kind(ranks);
-
-    // Pair and 2 Pair
-    if (n_of_a_kind >= 2)
-    {
-        hand_types.PAIR = 1;
-
-        if (hand_contains_two_pair(ranks))
-        {
-            hand_types.TWO_PAIR = 1;
-        }
-    }
-
-    // 3 OAK
-    if (n_of_a_kind >= 3)
-    {
-        hand_types.THREE_OF_A_KIND = 1;
-    }
-
-    // Straight
-    // ---> START MOBIUS JOKER STRAIGHT CHECK <---
-    if (hand_contains_straight(ranks)) {
-        hand_types.STRAIGHT = 1;
-    }
-
-    if (is_joker_owned(60)) {
-        int min_len = get_straight_and_flush_size();
-        bool shortcut = is_shortcut_joker_active();
-        int streak = 0;
-        int gaps = 0;
-
-        // Loop past 13 to allow the Ace (rank 12) to connect seamlessly to Two (rank 0)
-        for (int i = 0; i < 13 + min_len - 1; i++) {
-            if (ranks[i % 13] > 0) {
-                streak++;
-                gaps = 0;
-                if (streak >= min_len) hand_types.STRAIGHT = 1;
-            } else {
-                if (shortcut && gaps < 1 && streak > 0) {
-                    streak++;
-                    gaps++;
-                    if (streak >= min_len) hand_types.STRAIGHT = 1;
-                } else {
-                    streak = 0;
-                    gaps = 0;
-                }
-            }
-        }
-    }
-    // ---> END MOBIUS JOKER STRAIGHT CHECK <---
-
-    // Flush
-    bool has_flush = hand_contains_flush(suits); // Reverted to the standard function
-
-    if (is_joker_owned(58)) { // Smeared Joker
-        int red_count = suits[HEARTS] + suits[DIAMONDS];
-        int black_count = suits[SPADES] + suits[CLUBS];
-        
-        // This will dynamically be 4 or 5 depending on Four Fingers!
-        int required_size = get_straight_and_flush_size(); 
-        
-        if (red_count >= required_size || black_count >= required_size) {
-            has_flush = true;
-        }
-    }
-
-    if (has_flush)
-    {
-        hand_types.FLUSH = 1;
-    }
-
-    // Full House
-    if (n_of_a_kind >= 3 && hand_contains_full_house(ranks))
-    {
-        hand_types.FULL_HOUSE = 1;
-    }
-
-    // 4 OAK
-    if (n_of_a_kind >= 4)
-    {
-        hand_types.FOUR_OF_A_KIND = 1;
-    }
-
-    // Straight Flush
-    if (hand_types.STRAIGHT && hand_types.FLUSH)
-    {
-        hand_types.STRAIGHT_FLUSH = 1;
-    }
-
-    // Royal Flush
-    if (hand_types.STRAIGHT_FLUSH)
-    {
-        if (ranks[TEN] && ranks[JACK] && ranks[QUEEN] && ranks[KING] && ranks[ACE])
-        {
-            hand_types.ROYAL_FLUSH = 1;
-        }
-    }
-
-    // 5 OAK
-    if (n_of_a_kind >= 5)
-    {
-        hand_types.FIVE_OF_A_KIND = 1;
-    }
-
-    // Flush House and Five
-    if (hand_types.FLUSH)
-    {
-        if (hand_types.FULL_HOUSE)
-        {
-            hand_types.FLUSH_HOUSE = 1;
-        }
-
-        if (hand_types.FIVE_OF_A_KIND)
-        {
-            hand_types.FLUSH_FIVE = 1;
-        }
-    }
-
-    return hand_types;
+    // Toggling the same card back and forth usually hits the memo
+    return hand_memo_eval(&hand_selection_bb, &_rule_set, _hand_eval_func, NULL);
 }
 
 ContainedHandTypes* get_contained_hands(void)
 {
+    if (_score_preview)
+        return &_score_preview->contained_hands;
     return &_contained_hands;
 }
 
 enum HandType compute_hand_type(struct ContainedHandTypes contained_types)
 {
-    enum HandType ret;
-
-    // test each pit see if it's set to 1, and return the first one
-    for (ret = FLUSH_FIVE; ret > NONE; ret--)
-    {
-        // Shift the bit we want to check to the front and mask it with 1 to keep only that
-        // Since the ContainedHandTypes is ordered the same way as the HandType enum, we
-        // can shift right by ret-1 to have the bit we want at the front
-        if ((contained_types.value >> (ret - 1)) & 0x1)
-        {
-            break;
-        }
-    }
-
-    // If we broke early, ret contains the value of the HandType enum corresponding to
-    // the position of the highest bit set to 1 in contained_types.value, which is the
-    // most powerful poker hand contained in the current Hand
-    // If not, then it contains NONE, which is what we're supposed to return when there
-    // are no Hands contained in what we played
-    return ret;
+    return hand_eval_highest_type(contained_types);
 }
 
 enum HandType* get_hand_type(void)
 {
+    if (_score_preview)
+        return &_score_preview->hand_type;
     return &hand_type;
 }
 
+void game_set_score_preview(ScorePreview* preview)
+{
+    _score_preview = preview;
+}
+
+bool game_is_score_preview(void)
+{
+    return _score_preview != NULL;
+}
+
 // Returns true if the card is *considered* a face card
 bool card_is_face(Card* card)
 {
     // Card is a face card, or Pareidolia is present
-    return (
-        card->rank == JACK || card->rank == QUEEN || card->rank == KING ||
-        is_joker_owned(PAREIDOLIA_JOKER_ID)
-    );
+    return rule_set_card_is_face(&_rule_set, card);
 }
 
 /* Copies the appropriate item into the top left panel (blind/shop icon)
@@ -2004,12 +1961,12 @@ static void set_hand(void)
     _contained_hands = compute_contained_hand_types();
     hand_type = compute_hand_type(_contained_hands);
 
-    HandValues hand = hand_base_values[hand_type];
+    const HandValues* hand = hand_eval_base_values(hand_type);
 
-    chips = hand.chips;
-    mult = hand.mult;
+    chips = hand->chips;
+    mult = hand->mult;
 
-    print_hand_type(hand.display_name);
+    print_hand_type(hand->display_name);
     display_chips();
     display_mult();
 }
@@ -2047,22 +2004,27 @@ static void increment_blind(enum BlindState increment_reason)
     }
 }
 
-static inline void deck_shuffle(void)
+static inline void cards_shuffle(Card** cards, int top)
 {
-    for (int i = deck_top; i > 0; i--)
+    for (int i = top; i > 0; i--)
     {
         int j = rand() % (i + 1);
-        Card* temp = deck[i];
-        deck[i] = deck[j];
-        deck[j] = temp;
+        Card* temp = cards[i];
+        cards[i] = cards[j];
+        cards[j] = temp;
     }
 }
 
+static inline void deck_shuffle(void)
+{
+    cards_shuffle(deck, deck_top);
+}
+
 static void game_round_on_init()
 {
     hand_state = HAND_DRAW;
     cards_drawn = 0;
-    hand_selections = 0;
+    hand_clear_selections();
 
     // ---> START JAKER & LAST DANCE HOOK <---
     int jaker_bonus = 0;
@@ -2276,8 +2238,7 @@ static void hand_deselect_all_cards(void)
     {
         if (card_object_is_selected(hand[i]))
         {
-            card_object_set_selected(hand[i], false);
-            hand_selections--;
+            hand_set_card_selected(hand[i], false);
             any_cards_deselected = true;
         }
     }
@@ -2529,14 +2490,12 @@ static void hand_select_card(int index)
 
     if (card_object_is_selected(hand[index]))
     {
-        card_object_set_selected(hand[index], false);
-        hand_selections--;
+        hand_set_card_selected(hand[index], false);
         play_sfx(SFX_CARD_DESELECT, MM_BASE_PITCH_RATE, SFX_DEFAULT_VOLUME);
     }
     else if (hand_selections < MAX_SELECTION_SIZE)
     {
-        card_object_set_selected(hand[index], true);
-        hand_selections++;
+        hand_set_card_selected(hand[index], true);
         play_sfx(SFX_CARD_SELECT, MM_BASE_PITCH_RATE, SFX_DEFAULT_VOLUME);
     }
     set_hand();
@@ -2572,6 +2531,108 @@ static inline void card_draw(void)
     );
 }
 
+/* -------------------------------------------------------------------------
+ * ai_deck_prepare
+ *
+ * Builds the AI deck from statically-allocated Card storage and shuffles it
+ * into _ai_deck_order, unless that was already done for the coming AI turn.
+ * We cannot use card_new() because the Card pool is full (all 52 slots are
+ * occupied by the player's cards which remain live for the next round).
+ * ------------------------------------------------------------------------- */
+static void ai_deck_prepare(void)
+{
+    if (!_ai_cards_initialized)
+    {
+        for (int s = 0; s < NUM_SUITS; s++)
+        {
+            for (int r = 0; r < NUM_RANKS; r++)
+            {
+                int idx           = s * NUM_RANKS + r;
+                _ai_cards[idx].suit = (u8)s;
+                _ai_cards[idx].rank = (u8)r;
+            }
+        }
+        _ai_cards_initialized = true;
+    }
+
+    if (_ai_deck_order_ready)
+        return;
+
+    for (int i = 0; i < MAX_DECK_SIZE; i++)
+        _ai_deck_order[i] = &_ai_cards[i];
+
+    cards_shuffle(_ai_deck_order, MAX_DECK_SIZE - 1); // Randomise the AI deck
+    _ai_deck_order_ready = true;
+}
+
+/* -------------------------------------------------------------------------
+ * ai_precompute_idle
+ *
+ * Called every frame the player idles in HAND_SELECT in vs-AI mode.
+ *
+ * Shuffles the AI deck ahead of its turn and walks the subsets of the hand
+ * the AI is going to open with, a small slice per frame, so the AI's first
+ * decision doesn't have to start from scratch.
+ * ------------------------------------------------------------------------- */
+static void ai_precompute_idle(void)
+{
+    if (!ai_precompute_started)
+    {
+        ai_deck_prepare();
+
+        // card_draw() pops from the top of the deck until the hand is full
+        int opening_size = (hand_size < MAX_HAND_SIZE) ? hand_size : MAX_HAND_SIZE;
+        ai_opening_hand_size = 0;
+        for (int i = MAX_DECK_SIZE - 1; i >= 0 && ai_opening_hand_size < opening_size; i--)
+            ai_opening_hand[ai_opening_hand_size++] = _ai_deck_order[i];
+
+        ai_precompute_begin(ai_opening_hand, ai_opening_hand_size);
+        ai_precompute_started = true;
+    }
+
+    ai_precompute_step(AI_PRECOMPUTE_FRAME_BUDGET_CYCLES);
+}
+
+/* -------------------------------------------------------------------------
+ * ai_order_like_opening_hand
+ *
+ * Lays the compact hand out in the order the opening hand was precomputed
+ * in, since the sorted hand[] order differs, so that ai_search_begin() can
+ * pick up the precomputed walk. Leaves it alone if the cards differ.
+ * ------------------------------------------------------------------------- */
+static void ai_order_like_opening_hand(void)
+{
+    if (ai_opening_hand_size != ai_hand_size)
+        return;
+
+    Card* cards[MAX_HAND_SIZE];
+    int   idx_map[MAX_HAND_SIZE];
+    for (int o = 0; o < ai_opening_hand_size; o++)
+    {
+        int found = -1;
+        for (int ci = 0; ci < ai_hand_size; ci++)
+        {
+            if (ai_hand_cards[ci] == ai_opening_hand[o])
+            {
+                found = ci;
+                break;
+            }
+        }
+
+        if (found < 0)
+            return;
+
+        cards[o]   = ai_hand_cards[found];
+        idx_map[o] = ai_card_idx_map[found];
+    }
+
+    for (int ci = 0; ci < ai_hand_size; ci++)
+    {
+        ai_hand_cards[ci]   = cards[ci];
+        ai_card_idx_map[ci] = idx_map[ci];
+    }
+}
+
 /* -------------------------------------------------------------------------
  * game_ai_turn_start
  *
@@ -2593,30 +2654,18 @@ static void game_ai_turn_start(void)
         _player_deck_save[i] = deck[i];
 
     // ------------------------------------------------------------------
-    // 2. Build the AI deck from statically-allocated Card storage.
-    //    We cannot use card_new() because the Card pool is full (all 52
-    //    slots are occupied by the player's cards which remain live for
-    //    the next round).
+    // 2. Load the AI deck, usually already shuffled during the player's
+    //    turn so its opening hand could be precomputed.
     // ------------------------------------------------------------------
-    if (!_ai_cards_initialized)
-    {
-        for (int s = 0; s < NUM_SUITS; s++)
-        {
-            for (int r = 0; r < NUM_RANKS; r++)
-            {
-                int idx           = s * NUM_RANKS + r;
-                _ai_cards[idx].suit = (u8)s;
-                _ai_cards[idx].rank = (u8)r;
-            }
-        }
-        _ai_cards_initialized = true;
-    }
+    ai_deck_prepare();
 
     deck_top = -1;
     for (int i = 0; i < MAX_DECK_SIZE; i++)
-        deck[++deck_top] = &_ai_cards[i];
+        deck[++deck_top] = _ai_deck_order[i];
+    deck_comp_from_cards(&deck_composition, deck, deck_top + 1);
 
-    deck_shuffle(); // Randomise the AI deck
+    _ai_deck_order_ready  = false; // The next AI turn gets a fresh shuffle
+    ai_precompute_started = false;
 
     // ------------------------------------------------------------------
     // 3. Reset play-state variables for a fresh round.
@@ -2630,7 +2679,7 @@ static void game_ai_turn_start(void)
     discards            = max_discards;
     hand_state          = HAND_DRAW;
     play_state          = PLAY_STARTING;
-    hand_selections     = 0;
+    hand_clear_selections();
     cards_drawn         = 0;
     scored_card_index   = 0;
     played_top          = -1;
@@ -2638,6 +2687,8 @@ static void game_ai_turn_start(void)
     discarded_card      = false;
     timer               = TM_ZERO;
     ai_discard_cycle_count = 0;
+    ai_search_started   = false;
+    ai_discard_started  = false;
 
     // ---> START DDoS ATTACK JOKER HOOK (ID 108) <---
     if (is_joker_owned(108)) {
@@ -2647,9 +2698,9 @@ static void game_ai_turn_start(void)
     }
     // ---> END DDoS ATTACK JOKER HOOK <---
 
-    _joker_scored_itr          = list_itr_create(&_owned_jokers_list);
-    _joker_card_scored_end_itr = list_itr_create(&_owned_jokers_list);
-    _joker_round_end_itr       = list_itr_create(&_owned_jokers_list);
+    _joker_scored_idx          = 0;
+    _joker_card_scored_end_idx = 0;
+    _joker_round_end_idx       = 0;
 
     // Reset the selection grid back to the initial position
     game_playing_selection_grid.selection = GAME_PLAYING_INIT_SEL;
@@ -2739,6 +2790,7 @@ static void game_ai_turn_end(void)
     deck_top = -1;
     for (int i = 0; i <= _player_deck_save_top; i++)
         deck[++deck_top] = _player_deck_save[i];
+    deck_comp_from_cards(&deck_composition, deck, deck_top + 1);
 
     // Discard pile should already be empty (HAND_SHUFFLING flushed it),
     // but clear it for safety.
@@ -2746,92 +2798,145 @@ static void game_ai_turn_end(void)
 }
 
 /* -------------------------------------------------------------------------
- * ai_auto_play
+ * ai_discard_start
+ *
+ * Called from ai_think() once the hand search is done.
  *
- * Called from game_playing_process_input_and_state() when it is the AI's
- * turn and hand_state == HAND_SELECT.
+ * Discard decision logic:
+ *   - The AI may discard at most AI_MAX_DISCARDS_PER_CYCLE (2) times
+ *     before it MUST play a hand.  After playing, the counter resets.
+ *   - Within that limit ai_discard_begin() decides as the selected AI level
+ *     does, either sampling refills from the remaining deck or comparing the
+ *     best hand type against fixed thresholds, and discards 1-5 cards in a
+ *     single action.
  *
- * Asks ai_select_best_hand() for the optimal card combination, selects
- * those cards in the game engine (so the existing rendering / scoring
- * pipeline handles the rest), then calls game_playing_execute_play_hand().
+ * Returns false if the AI has to play, true if a decision was started.
  * ------------------------------------------------------------------------- */
-static void ai_auto_play(void)
+static bool ai_discard_start(void)
 {
-    if (hand_top < 0)
-        return; // Nothing in hand yet
+    bool          sel[MAX_HAND_SIZE] = {false};
+    enum HandType best_ht            = NONE;
+    int best_count = ai_search_finish(sel, &best_ht);
 
-    // Build a compact array of the current hand's Card* pointers.
-    // hand[] may have NULL gaps if cards were discarded, so we compress.
-    Card* ai_hand_cards[MAX_HAND_SIZE];
-    int   card_idx_map[MAX_HAND_SIZE]; // maps compact idx → hand[] index
-    int   ai_hand_size = 0;
+    if (ai_discard_cycle_count >= AI_MAX_DISCARDS_PER_CYCLE ||
+        discards <= 0 || best_count >= ai_hand_size)
+        return false;
 
-    for (int i = 0; i <= hand_top; i++)
+    ai_discard_begin(
+        ai_hand_cards,
+        ai_hand_size,
+        sel,
+        best_ht,
+        ai_discard_cycle_count,
+        deck,
+        deck_top + 1,
+        &deck_composition
+    );
+    return true;
+}
+
+/* -------------------------------------------------------------------------
+ * ai_think
+ *
+ * Called every frame from game_playing_process_input_and_state() when it is
+ * the AI's turn and hand_state == HAND_SELECT.
+ *
+ * Starts the hand search on the first frame the hand is complete and runs a
+ * slice of it every frame, then does the same with the discard decision, so
+ * the think delay is spent deciding instead of idling and no single frame
+ * carries a whole search. The AI acts once the delay has expired and the
+ * decision is made.
+ * ------------------------------------------------------------------------- */
+static void ai_think(void)
+{
+    if (!ai_search_started)
     {
-        if (hand[i] != NULL)
+        ai_hand_size = 0;
+        for (int i = 0; i <= hand_top; i++)
         {
-            ai_hand_cards[ai_hand_size] = hand[i]->card;
-            card_idx_map[ai_hand_size]  = i;
-            ai_hand_size++;
+            if (hand[i] != NULL)
+            {
+                ai_hand_cards[ai_hand_size] = hand[i]->card;
+                ai_card_idx_map[ai_hand_size] = i;
+                ai_hand_size++;
+            }
         }
-    }
 
-    if (ai_hand_size == 0)
-        return;
+        // Only the AI's first hand of the turn was precomputed
+        if (ai_opening_hand_size > 0)
+        {
+            ai_order_like_opening_hand();
+            ai_opening_hand_size = 0;
+        }
 
-    // Ask the AI brain for the best selection.
-    bool          sel[MAX_HAND_SIZE] = {false};
-    enum HandType best_ht            = NONE;
-    int best_count = ai_select_best_hand(ai_hand_cards, ai_hand_size, sel,
-                                         &best_ht);
-
-    // Discard decision logic:
-    //   - The AI may discard at most AI_MAX_DISCARDS_PER_CYCLE (2) times
-    //     before it MUST play a hand.  After playing, the counter resets.
-    //   - 1st discard chance: discard if hand is below STRAIGHT
-    //     (worth trying for a significant improvement).
-    //   - 2nd discard chance: only discard if hand is still below TWO_PAIR
-    //     (hand is still very weak after the first discard).
-    //   - The cards selected for discard are ALL leftover (non-best) cards,
-    //     so the AI always discards 1-5 cards in a single action.
-    int leftover = ai_hand_size - best_count;
-    bool should_discard = false;
-    if (ai_discard_cycle_count < AI_MAX_DISCARDS_PER_CYCLE &&
-        discards > 0 && leftover > 0)
-    {
-        if (ai_discard_cycle_count == 0)
+        ai_search_begin(ai_hand_cards, ai_hand_size);
+        ai_search_started = true;
+        ai_discard_started = false;
+    }
+
+    // The discard decision starts on the frame after the search is done, so a frame never gets
+    // more than one slice
+    bool decided = false;
+    if (ai_search_step(AI_SEARCH_FRAME_BUDGET_CYCLES))
+    {
+        if (!ai_discard_started)
         {
-            // First chance: discard anything below a STRAIGHT
-            should_discard = (best_ht < STRAIGHT);
+            ai_discard_pending = ai_discard_start();
+            ai_discard_started = true;
         }
         else
         {
-            // Second chance: only discard if hand is still below TWO_PAIR
-            should_discard = (best_ht < TWO_PAIR);
+            decided = !ai_discard_pending || ai_discard_step(AI_SEARCH_FRAME_BUDGET_CYCLES);
         }
     }
 
-    if (should_discard)
+    if (decided && timer >= FRAMES(AI_THINK_DELAY_FRAMES))
+    {
+        ai_search_started = false; // The next hand_state == HAND_SELECT starts a new search
+        ai_auto_play();
+    }
+}
+
+/* -------------------------------------------------------------------------
+ * ai_auto_play
+ *
+ * Called from ai_think() once the hand search and the discard decision are
+ * done.
+ *
+ * Takes the planned discard, or else the optimal card combination from the
+ * search, selects those cards in the game engine (so the existing rendering
+ * / scoring pipeline handles the rest), then calls
+ * game_playing_execute_discard() or game_playing_execute_play_hand().
+ * ------------------------------------------------------------------------- */
+static void ai_auto_play(void)
+{
+    if (ai_hand_size == 0)
+        return; // Nothing in hand yet
+
+    // Collect the best selection found by the search.
+    bool          sel[MAX_HAND_SIZE] = {false};
+    enum HandType best_ht            = NONE;
+    ai_search_finish(sel, &best_ht);
+
+    bool discard_sel[MAX_HAND_SIZE] = {false};
+    int  discard_count = ai_discard_pending ? ai_discard_finish(discard_sel) : 0;
+
+    if (discard_count > 0)
     {
         // Deselect everything first.
         for (int i = 0; i <= hand_top; i++)
         {
-            if (hand[i] && card_object_is_selected(hand[i]))
-                card_object_set_selected(hand[i], false);
+            if (hand[i])
+                hand_set_card_selected(hand[i], false);
         }
-        hand_selections = 0;
 
-        // Select ALL leftover cards for discard in one shot (up to
-        // MAX_SELECTION_SIZE, which is the per-action card limit).
-        int discard_count = 0;
-        for (int ci = 0; ci < ai_hand_size && discard_count < MAX_SELECTION_SIZE; ci++)
+        // Select the planned discard in one shot.
+        for (int ci = 0; ci < ai_hand_size; ci++)
         {
-            if (!sel[ci])
+            if (discard_sel[ci])
             {
-                int hi = card_idx_map[ci];
-                card_object_set_selected(hand[hi], true);
-                hand_selections++;
-                discard_count++;
+                int hi = ai_card_idx_map[ci];
+                hand_set_card_selected(hand[hi], true);
             }
         }
 
@@ -2847,8 +2952,7 @@ static void ai_auto_play(void)
     {
         if (hand[i] && card_object_is_selected(hand[i]))
         {
-            card_object_set_selected(hand[i], false);
-            hand_selections--;
+            hand_set_card_selected(hand[i], false);
         }
     }
 
@@ -2856,9 +2960,8 @@ static void ai_auto_play(void)
     {
         if (sel[ci])
         {
-            int hi = card_idx_map[ci];
-            card_object_set_selected(hand[hi], true);
-            hand_selections++;
+            int hi = ai_card_idx_map[ci];
+            hand_set_card_selected(hand[hi], true);
         }
     }
 
@@ -2918,7 +3021,7 @@ static inline void game_playing_handle_round_over(void)
             while (current_joker_idx < list_get_len(&_owned_jokers_list))
             {
                 JokerObject* joker_obj = (JokerObject*)list_get_at_idx(&_owned_jokers_list, current_joker_idx);
-                JokerEffect* effect = NULL;
+                JokerEffect effect = {0};
                 u32 flags = joker_get_score_effect(joker_obj->joker, NULL, JOKER_EVENT_ON_ROUND_END, &effect);
                 
                 if (flags != JOKER_EFFECT_FLAG_NONE) 
@@ -3002,6 +3105,7 @@ static inline void card_in_hand_loop_handle_discard_and_shuffling(
 
             if (hand[card_idx]->sprite_object->x >= *hand_x)
             {
+                hand_set_card_selected(hand[card_idx], false);
                 discard_push(hand[card_idx]->card);
                 card_object_destroy(&hand[card_idx]);
                 reorder_card_sprites_layers();
@@ -3045,245 +3149,26 @@ static inline void card_in_hand_loop_handle_discard_and_shuffling(
         hand_state = HAND_DRAW;
         sound_played = false;
         cards_drawn = 0;
-        hand_selections = 0;
+        hand_clear_selections();
         timer = TM_ZERO;
         *break_loop = true;
         return;
     };
 }
 
-static inline void select_flush_and_straight_cards_in_played_hand(void)
-{
-    // Special handling because Four Fingers might be active
-    bool final_selection[MAX_SELECTION_SIZE] = {false};
-
-    // Will be 4 if Four Fingers is in effect, otherwise 5
-    int min_len = get_straight_and_flush_size();
-
-    // if we have a flush in our hand
-    if (hand_type == FLUSH || hand_type == STRAIGHT_FLUSH || hand_type == ROYAL_FLUSH)
-    {
-        bool flush_selection[MAX_HAND_SIZE] = {false};
-
-        // ---> START SMEARED JOKER SELECTION <---
-        if (is_joker_owned(58)) {
-            int red_count = 0, black_count = 0;
-            for (int i = 0; i <= played_top; i++) {
-                u8 suit = played[i]->card->suit;
-                if (suit == HEARTS || suit == DIAMONDS) red_count++;
-                if (suit == SPADES || suit == CLUBS) black_count++;
-            }
-            bool look_for_red = red_count >= min_len;
-            bool look_for_black = black_count >= min_len;
-
-            // Mark all matching Smeared cards to visually "glow" when scored
-            for (int i = 0; i <= played_top; i++) {
-                u8 suit = played[i]->card->suit;
-                if (look_for_red && (suit == HEARTS || suit == DIAMONDS)) flush_selection[i] = true;
-                if (look_for_black && (suit == SPADES || suit == CLUBS)) flush_selection[i] = true;
-            }
-        } else {
-            find_flush_in_played_cards(played, played_top, min_len, flush_selection);
-        }
-        // ---> END SMEARED JOKER SELECTION <---
-
-        // Add the results into the final selection
-        for (int i = 0; i <= played_top; i++)
-        {
-            final_selection[i] = flush_selection[i];
-        }
-    }
-
-    // If we have a straight in our hand
-    if (hand_type == STRAIGHT || hand_type == STRAIGHT_FLUSH || hand_type == ROYAL_FLUSH)
-    {
-        bool straight_selection[MAX_HAND_SIZE] = {false};
-        find_straight_in_played_cards(
-            played,
-            played_top,
-            is_shortcut_joker_active(),
-            min_len,
-            straight_selection
-        );
-        // Add the results into the final selection
-        for (int i = 0; i <= played_top; i++)
-        {
-            final_selection[i] = final_selection[i] || straight_selection[i];
-        }
-        // If Four Fingers is active, pairs can happen in a valid straight
-        // If Four Fingers is not active, pairs are impossible so this will not affect things
-        select_paired_cards_in_hand(played, played_top, final_selection);
-    }
-
-    // Finally, set mark the cards as selected based final_selection
-    for (int i = 0; i <= played_top; i++)
-    {
-        if (final_selection[i])
-        {
-            card_object_set_selected(played[i], true);
-        }
-    }
-}
-
-static inline void select_all_five_cards_in_played_hand(void)
-{
-    for (int i = 0; i <= played_top; i++)
-    {
-        card_object_set_selected(played[i], true);
-    }
-}
-
-static inline void select_four_of_a_kind_cards_in_played_hand(void)
-{
-    // find four cards with the same rank
-    // If there are 5 cards selected we just need to find the one card that doesn't match, and
-    // select the others
-    if (played_top >= 3)
-    {
-        int unmatched_index = -1;
-
-        for (int i = 0; i <= played_top; i++)
-        {
-            if (played[i]->card->rank != played[(i + 1) % played_top]->card->rank &&
-                played[i]->card->rank != played[(i + 2) % played_top]->card->rank)
-            {
-                unmatched_index = i;
-                break;
-            }
-        }
-
-        for (int i = 0; i <= played_top; i++)
-        {
-            if (i != unmatched_index)
-            {
-                card_object_set_selected(played[i], true);
-            }
-        }
-    }
-    else // If there are only 4 cards selected we know they match
-    {
-        for (int i = 0; i <= played_top; i++)
-        {
-            card_object_set_selected(played[i], true);
-        }
-    }
-}
-
-static inline void select_three_of_a_kind_cards_in_played_hand(void)
-{
-    // find three cards with the same rank
-    for (int i = 0; i <= played_top - 1; i++)
-    {
-        for (int j = i + 1; j <= played_top; j++)
-        {
-            if (played[i]->card->rank == played[j]->card->rank)
-            {
-                card_object_set_selected(played[i], true);
-                card_object_set_selected(played[j], true);
-
-                for (int k = j + 1; k <= played_top; k++)
-                {
-                    if (played[i]->card->rank == played[k]->card->rank &&
-                        !card_object_is_selected(played[k]))
-                    {
-                        card_object_set_selected(played[k], true);
-                        break;
-                    }
-                }
-
-                break;
-            }
-        }
-
-        if (card_object_is_selected(played[i]))
-            break;
-    }
-}
-
-static inline void select_two_pair_cards_in_played_hand(void)
-{
-    // find two pairs of cards with the same rank
-    int i;
-
-    for (i = 0; i <= played_top - 1; i++)
-    {
-        for (int j = i + 1; j <= played_top; j++)
-        {
-            if (played[i]->card->rank == played[j]->card->rank)
-            {
-                card_object_set_selected(played[i], true);
-                card_object_set_selected(played[j], true);
-
-                break;
-            }
-        }
-
-        if (card_object_is_selected(played[i]))
-            break;
-    }
-
-    for (; i <= played_top - 1; i++) // Find second pair
-    {
-        for (int j = i + 1; j <= played_top; j++)
-        {
-            if (played[i]->card->rank == played[j]->card->rank &&
-                !card_object_is_selected(played[i]) && !card_object_is_selected(played[j]))
-            {
-                card_object_set_selected(played[i], true);
-                card_object_set_selected(played[j], true);
-                break;
-            }
-        }
-    }
-}
-
-static inline void select_pair_cards_in_played_hand(void)
-{
-    // find two cards with the same rank
-    for (int i = 0; i <= played_top - 1; i++)
-    {
-        for (int j = i + 1; j <= played_top; j++)
-        {
-            if (played[i]->card->rank == played[j]->card->rank)
-            {
-                card_object_set_selected(played[i], true);
-                card_object_set_selected(played[j], true);
-                break;
-            }
-        }
-
-        if (card_object_is_selected(played[i]))
-            break;
-    }
-}
-
-static inline void select_highcard_cards_in_played_hand(void)
-{
-    // find the card with the highest rank in the hand
-    int highest_rank_index = 0;
-
-    for (int i = 0; i <= played_top; i++)
-    {
-        if (played[i]->card->rank > played[highest_rank_index]->card->rank)
-        {
-            highest_rank_index = i;
-        }
-    }
-
-    card_object_set_selected(played[highest_rank_index], true);
-}
-
+// Scores the subscribers of joker_event from *joker_idx on and stops after the first one that
+// has an effect, leaving *joker_idx on the next one so the pass can resume on a later frame.
 // returns true if a joker was scored, false otherwise
 static bool check_and_score_joker_for_event(
-    ListItr* starting_joker_itr,
+    int* joker_idx,
     CardObject* card_object,
     enum JokerEvent joker_event
 )
 {
-    JokerObject* joker;
-
-    while ((joker = list_itr_next(starting_joker_itr)))
+    while (*joker_idx < _joker_event_subscriber_counts[joker_event])
     {
+        JokerObject* joker = _joker_event_subscribers[joker_event][(*joker_idx)++];
+
         // ---> START JAMMING JOKER HOOK (ID 106) <---
         // If AI is playing, you own Jamming, and this specific Joker is the leftmost one (index 0)
         if (ai_is_playing && is_joker_owned(106) && joker == list_get_at_idx(&_owned_jokers_list, 0)) {
@@ -3339,10 +3224,10 @@ static bool play_ended_played_cards_update(int played_idx)
 
                 play_state = PLAY_STARTING;
                 cards_drawn = 0;
-                hand_selections = 0;
+                hand_clear_selections();
                 played_top = -1; 
                 scored_card_index = 0;
-                _joker_scored_itr = list_itr_create(&_owned_jokers_list);
+                _joker_scored_idx = 0;
                 timer = TM_ZERO;
             }
             return true; 
@@ -3364,7 +3249,7 @@ static inline void play_starting_played_cards_update(int played_idx)
 
         if (scored_card_index == 0)
         {
-            _joker_scored_itr = list_itr_create(&_owned_jokers_list);
+            _joker_scored_idx = 0;
             timer = TM_ZERO;
             play_state = PLAY_BEFORE_SCORING;
         }
@@ -3385,7 +3270,7 @@ static inline void play_starting_played_cards_update(int played_idx)
 static inline bool play_before_scoring_cards_update(void)
 {
     // Activate Jokers with an effect just before the hand is scored
-    if (check_and_score_joker_for_event(&_joker_scored_itr, NULL, JOKER_EVENT_ON_HAND_PLAYED))
+    if (check_and_score_joker_for_event(&_joker_scored_idx, NULL, JOKER_EVENT_ON_HAND_PLAYED))
     {
         return true;
     }
@@ -3412,7 +3297,7 @@ static inline bool play_scoring_cards_update(void)
         if (scored_card_index > played_top)
         {
             // reuse these variables for held cards
-            _joker_scored_itr = list_itr_create(&_owned_jokers_list);
+            _joker_scored_idx = 0;
             scored_card_index = hand_top;
 
             play_state = PLAY_SCORING_HELD_CARDS;
@@ -3459,8 +3344,8 @@ static inline bool play_scoring_cards_update(void)
             display_chips();
 
             // Allow Joker scoring
-            _joker_scored_itr = list_itr_create(&_owned_jokers_list);
-            _joker_card_scored_end_itr = list_itr_create(&_owned_jokers_list);
+            _joker_scored_idx = 0;
+            _joker_card_scored_end_idx = 0;
         }
 
         play_state = PLAY_SCORING_CARD_JOKERS;
@@ -3481,7 +3366,7 @@ static inline bool play_scoring_card_jokers_update(void)
         // since we sought the next scoring card index in the previous state,
         // scored_card_index is guaranteed to be a scoring card
         if (check_and_score_joker_for_event(
-                &_joker_scored_itr,
+                &_joker_scored_idx,
                 played[scored_card_index],
                 JOKER_EVENT_ON_CARD_SCORED
             ))
@@ -3492,7 +3377,7 @@ static inline bool play_scoring_card_jokers_update(void)
         // Trigger all Jokers that have an effect when a card finishes scoring
         // (e.g. retriggers) after activating all the other scored_card Jokers normally
         if (check_and_score_joker_for_event(
-                &_joker_card_scored_end_itr,
+                &_joker_card_scored_end_idx,
                 played[scored_card_index],
                 JOKER_EVENT_ON_CARD_SCORED_END
             ))
@@ -3527,7 +3412,7 @@ static inline bool play_scoring_held_cards_update(int played_idx)
         for (; scored_card_index >= 0; scored_card_index--)
         {
             if (check_and_score_joker_for_event(
-                    &_joker_scored_itr,
+                    &_joker_scored_idx,
                     hand[scored_card_index],
                     JOKER_EVENT_ON_CARD_HELD
                 ))
@@ -3535,11 +3420,11 @@ static inline bool play_scoring_held_cards_update(int played_idx)
                 card_object_shake(hand[scored_card_index], SFX_CARD_SELECT);
                 return true;
             }
-            _joker_scored_itr = list_itr_create(&_owned_jokers_list);
+            _joker_scored_idx = 0;
         }
 
         scored_card_index = 0;
-        _joker_round_end_itr = list_itr_create(&_owned_jokers_list);
+        _joker_round_end_idx = 0;
         play_state = PLAY_SCORING_INDEPENDENT_JOKERS;
     }
 
@@ -3555,7 +3440,7 @@ static inline bool play_scoring_independent_jokers_update(int played_idx)
 
         tte_erase_rect_wrapper(PLAYED_CARDS_SCORES_RECT);
 
-        if (check_and_score_joker_for_event(&_joker_scored_itr, NULL, JOKER_EVENT_INDEPENDENT))
+        if (check_and_score_joker_for_event(&_joker_scored_idx, NULL, JOKER_EVENT_INDEPENDENT))
         {
             return true;
         }
@@ -3578,7 +3463,7 @@ static inline bool play_scoring_hand_scored_end_update(int played_idx)
         tte_erase_rect_wrapper(PLAYED_CARDS_SCORES_RECT);
 
         bool scored = check_and_score_joker_for_event(
-            &_joker_round_end_itr,
+            &_joker_round_end_idx,
             NULL,
             JOKER_EVENT_ON_HAND_SCORED_END
         );
@@ -3805,8 +3690,11 @@ static inline void game_playing_process_input_and_state(void)
     // ---> 2. REGULAR ENGINE LOGIC <---
     if (hand_state == HAND_SELECT) {
         if (deck_get_size() == 0) { hands = 0; hand_state = HAND_SHUFFLING; game_lose_on_init(); }
-        if (ai_is_playing) { if (timer >= FRAMES(AI_THINK_DELAY_FRAMES)) ai_auto_play(); }
-        else { game_playing_process_hand_select_input(); }
+        if (ai_is_playing) { ai_think(); }
+        else {
+            game_playing_process_hand_select_input();
+            if (ai_mode_enabled) ai_precompute_idle();
+        }
     }
     else if (play_state == PLAY_ENDING) {
         if (mult > 0) {
@@ -3897,43 +3785,24 @@ static inline void game_playing_discarded_cards_loop(void)
 
 static inline void select_cards_in_played_hand()
 {
-    switch (hand_type) // select the cards that apply to the hand type
+    Card* played_cards[MAX_SELECTION_SIZE];
+    HandBitboard played_bb;
+
+    get_played_bitboard(&played_bb);
+    for (int i = 0; i <= played_top; i++)
     {
-        case NONE:
-            break;
-        case HIGH_CARD:
-            select_highcard_cards_in_played_hand();
-            break;
-        case PAIR:
-            select_pair_cards_in_played_hand();
-            break;
-        case TWO_PAIR:
-            select_two_pair_cards_in_played_hand();
-            break;
-        case THREE_OF_A_KIND:
-            select_three_of_a_kind_cards_in_played_hand();
-            break;
-        case FOUR_OF_A_KIND:
-            select_four_of_a_kind_cards_in_played_hand();
-            break;
-        case STRAIGHT:
-            /* FALL THROUGH */
-        case FLUSH:
-            /* FALL THROUGH */
-        case STRAIGHT_FLUSH:
-            /* FALL THROUGH */
-        case ROYAL_FLUSH:
-            select_flush_and_straight_cards_in_played_hand();
-            break;
-        case FULL_HOUSE:
-            /* FALL THROUGH */
-        case FIVE_OF_A_KIND:
-            /* FALL THROUGH */
-        case FLUSH_HOUSE:
-            /* FALL THROUGH */
-        case FLUSH_FIVE: // Select all played cards in the hand
-            select_all_five_cards_in_played_hand();
-            break;
+        played_cards[i] = played[i]->card;
+    }
+
+    u8 scoring_mask =
+        hand_eval_scoring_mask(&played_bb, played_cards, played_top + 1, hand_type, &_rule_set);
+
+    for (int i = 0; i <= played_top; i++)
+    {
+        if ((scoring_mask >> i) & 0x1)
+        {
+            card_object_set_selected(played[i], true);
+        }
     }
 }
 
@@ -4007,7 +3876,7 @@ static inline void cards_in_hand_update_loop(void)
                     if (card_object_is_selected(hand[i]) && discarded_card == false &&
                         timer % FRAMES(10) == 0)
                     {
-                        card_object_set_selected(hand[i], false);
+                        hand_set_card_selected(hand[i], false);
                         played_push(hand[i]);
                         sprite_destroy(&hand[i]->sprite_object->sprite);
                         hand[i] = NULL;
@@ -4020,7 +3889,6 @@ static inline void cards_in_hand_update_loop(void)
                         );
 
                         hand_top--;
-                        hand_selections--;
                         cards_drawn++;
 
                         discarded_card = true;
@@ -4030,7 +3898,7 @@ static inline void cards_in_hand_update_loop(void)
                     {
                         hand_state = HAND_PLAYING;
                         cards_drawn = 0;
-                        hand_selections = 0;
+                        hand_clear_selections();
                         timer = TM_ZERO;
                         scored_card_index = played_top + 1;
 
@@ -4764,6 +4632,7 @@ static bool jokers_sel_row_on_selection_changed(
             (unsigned int)prev_selection->x,
             (unsigned int)new_selection->x
         );
+        on_owned_jokers_changed();
     }
 
     return true;
@@ -4855,7 +4724,7 @@ static int shop_top_row_get_size(void)
 static inline void add_to_held_jokers(JokerObject* joker_object)
 {
     joker_object->sprite_object->ty = int2fx(HELD_JOKERS_POS.y);
-    add_joker(joker_object);
+    add_owned_joker(joker_object);
 }
 
 static inline void game_shop_buy_joker(int shop_joker_idx)
@@ -5556,7 +5425,7 @@ static inline void game_start(void)
     //     JokerObject* obj = joker_object_new(joker_new(test_jokers[i]));
     //     obj->sprite_object->y = int2fx(HELD_JOKERS_POS.y);
     //     obj->sprite_object->ty = int2fx(HELD_JOKERS_POS.y);
-    //     add_joker(obj);
+    //     add_owned_joker(obj);
     // }
     // --- DEBUG TOOL: Instant Modded Cards ---
     // if (custom_jokers_enabled)
@@ -5567,7 +5436,7 @@ static inline void game_start(void)
     //         JokerObject* obj = joker_object_new(joker_new(my_new_cards[i]));
     //         obj->sprite_object->y = int2fx(HELD_JOKERS_POS.y);
     //         obj->sprite_object->ty = int2fx(HELD_JOKERS_POS.y);
-    //         add_joker(obj);
+    //         add_owned_joker(obj);
     //     }
     // }
 
@@ -5613,6 +5482,16 @@ static void game_main_menu_on_update(void)
         custom_jokers_enabled ? 'X' : ' '
     );
 
+    // --- 4b. Draw the AI level, cycled with up/down while CLANKER MODE is hovered ---
+    Rect ai_level_rect = { 176, 144, 232, 160 };
+    tte_erase_rect_wrapper(ai_level_rect);
+    tte_printf(
+        "#{P:%d,%d; cx:0x%X000}%s",
+        ai_level_rect.left, ai_level_rect.top,
+        (selection_x == MAIN_MENU_AI_BTN_IDX) ? TTE_YELLOW_PB : TTE_WHITE_PB,
+        ai_get_level_info(ai_get_level())->name
+    );
+
     // --- 5. Apply the Active Highlight & Handle Input ---
     if (selection_x == MAIN_MENU_MOD_BTN_IDX)
     {
@@ -5647,6 +5526,13 @@ static void game_main_menu_on_update(void)
         // Hovered! Turn the CLANKER MODE border Pure White!
         if (ai_border_pid != -1) pal_bg_mem[ai_border_pid] = 0x7FFF;
 
+        if (key_hit(KEY_UP) || key_hit(KEY_DOWN))
+        {
+            int level = ai_get_level() + (key_hit(KEY_UP) ? 1 : AI_NUM_LEVELS - 1);
+            ai_set_level(level % AI_NUM_LEVELS);
+            play_sfx(SFX_CARD_FOCUS, MM_BASE_PITCH_RATE, SFX_DEFAULT_VOLUME);
+        }
+
         if (key_hit(SELECT_CARD))
         {
             play_sfx(SFX_BUTTON, MM_BASE_PITCH_RATE, BUTTON_SFX_VOLUME);
@@ -5695,6 +5581,8 @@ static void game_lose_on_update()
 static void game_over_on_exit()
 {
     ai_is_playing = false; // Reset AI state
+    ai_precompute_started = false;
+    ai_opening_hand_size = 0;
     while (list_get_len(&_owned_jokers_list) > 0)
     {
         JokerObject* joker_object = list_get_at_idx(&_owned_jokers_list, 0);
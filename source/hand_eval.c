@@ -0,0 +1,578 @@
+#include "hand_eval.h"
+
+#include "hand_class_lut.h"
+#include "straight_lut.h"
+#include "util.h"
+
+#include <stddef.h>
+
+// One bit per suit byte, used to run the same operation on every lane at once
+#define SUIT_BYTE_ONES 0x01010101UL
+#define SUIT_BYTE_HIGH (SUIT_BYTE_ONES << 7)
+
+void hand_bitboard_clear(HandBitboard* bb)
+{
+    for (int i = 0; i < NUM_SUITS; i++)
+        bb->suit_ranks[i] = 0;
+    bb->rank_mask = 0;
+    bb->suit_counts = 0;
+    bb->rank_counts = 0;
+}
+
+void hand_bitboard_add_card(HandBitboard* bb, const Card* card)
+{
+    bb->suit_ranks[card->suit] |= 1 << card->rank;
+    bb->rank_mask |= 1 << card->rank;
+    bb->suit_counts += 1UL << (card->suit * 8);
+    rank_hist_add(&bb->rank_counts, card->rank);
+}
+
+void hand_bitboard_remove_card(HandBitboard* bb, const Card* card)
+{
+    bb->suit_ranks[card->suit] &= ~(1 << card->rank);
+    bb->suit_counts -= 1UL << (card->suit * 8);
+    rank_hist_remove(&bb->rank_counts, card->rank);
+
+    if (rank_hist_count(bb->rank_counts, card->rank) == 0)
+    {
+        bb->rank_mask &= ~(1 << card->rank);
+    }
+}
+
+void hand_bitboard_merge(HandBitboard* bb, const HandBitboard* other)
+{
+    for (int i = 0; i < NUM_SUITS; i++)
+        bb->suit_ranks[i] |= other->suit_ranks[i];
+    bb->rank_mask |= other->rank_mask;
+    bb->suit_counts += other->suit_counts;
+    rank_hist_merge(&bb->rank_counts, other->rank_counts);
+}
+
+void hand_bitboard_from_cards(HandBitboard* bb_out, Card** cards, int count)
+{
+    hand_bitboard_clear(bb_out);
+    for (int i = 0; i < count; i++)
+    {
+        if (cards[i])
+            hand_bitboard_add_card(bb_out, cards[i]);
+    }
+}
+
+// Returns the highest N of a kind. So a full-house would return 3.
+uint8_t hand_contains_n_of_a_kind(const HandBitboard* bb)
+{
+    return rank_hist_max_count(bb->rank_counts);
+}
+
+bool hand_contains_two_pair(const HandBitboard* bb)
+{
+    return rank_hist_pairs_count(bb->rank_counts) >= 2;
+}
+
+bool hand_contains_full_house(const HandBitboard* bb)
+{
+    uint16_t threes = rank_hist_ranks_at_least(bb->rank_counts, 3);
+    uint16_t pairs = rank_hist_ranks_at_least(bb->rank_counts, 2) & ~threes;
+
+    // Full house if there is:
+    // - at least one three-of-a-kind and at least one other pair,
+    // - OR at least two three-of-a-kinds (second "three" acts as pair).
+    // This accounts for hands with 6 or more cards even though
+    // they are currently not possible and probably never will be.
+    return __builtin_popcount(threes) >= 2 || (threes && pairs);
+}
+
+static inline int straight_size(bool four_fingers)
+{
+    return four_fingers ? STRAIGHT_AND_FLUSH_SIZE_FOUR_FINGERS : STRAIGHT_AND_FLUSH_SIZE_DEFAULT;
+}
+
+// Straights are a single lookup in the generated straight_lut, see scripts/generate_straight_lut.py
+static GBAL_ALWAYS_INLINE bool contains_straight(
+    uint16_t rank_mask,
+    bool four_fingers,
+    bool shortcut,
+    bool mobius_wrap,
+    bool legacy_wrap
+)
+{
+    int plane = straight_lut_plane(four_fingers, shortcut, mobius_wrap);
+
+    if (straight_lut_lookup(rank_mask, plane))
+        return true;
+
+    // Joker 60 runs its own wrap-around streak check on top of the regular one
+    int legacy_plane = (plane & ~STRAIGHT_LUT_WRAP) | STRAIGHT_LUT_LEGACY_WRAP;
+    return legacy_wrap && straight_lut_lookup(rank_mask, legacy_plane);
+}
+
+static GBAL_ALWAYS_INLINE bool contains_flush(uint32_t suit_counts, int needed, bool smeared)
+{
+    if (smeared)
+    {
+        // Fold hearts onto diamonds and spades onto clubs: byte 0 is red, byte 1 is black
+        suit_counts = (suit_counts + (suit_counts >> 16)) & 0xFFFF;
+    }
+
+    // Counts never exceed a few dozen cards so adding (0x80 - needed) only reaches bit 7
+    // of a lane when the suit has at least `needed` cards
+    return ((suit_counts + SUIT_BYTE_ONES * (0x80 - needed)) & SUIT_BYTE_HIGH) != 0;
+}
+
+bool hand_contains_straight(const HandBitboard* bb, const RuleSet* rules)
+{
+    return contains_straight(
+        bb->rank_mask,
+        rules->straight_size == STRAIGHT_AND_FLUSH_SIZE_FOUR_FINGERS,
+        rules->shortcut,
+        rules->mobius_wrap,
+        rules->legacy_wrap
+    );
+}
+
+bool hand_contains_flush(const HandBitboard* bb, const RuleSet* rules)
+{
+    return contains_flush(bb->suit_counts, rules->straight_size, rules->smeared);
+}
+
+// Generic evaluator body, every rule is a parameter so that the variants below fold them away
+static GBAL_ALWAYS_INLINE ContainedHandTypes contained_types(
+    const HandBitboard* bb,
+    bool four_fingers,
+    bool shortcut,
+    bool smeared,
+    bool mobius_wrap,
+    bool legacy_wrap
+)
+{
+    ContainedHandTypes hand_types = {0};
+
+    if (bb->rank_mask == 0)
+    {
+        return hand_types;
+    }
+
+    hand_types.HIGH_CARD = 1;
+
+    uint8_t n_of_a_kind = hand_contains_n_of_a_kind(bb);
+
+    // Pair and 2 Pair
+    if (n_of_a_kind >= 2)
+    {
+        hand_types.PAIR = 1;
+
+        if (hand_contains_two_pair(bb))
+        {
+            hand_types.TWO_PAIR = 1;
+        }
+    }
+
+    // 3 OAK
+    if (n_of_a_kind >= 3)
+    {
+        hand_types.THREE_OF_A_KIND = 1;
+    }
+
+    // Straight
+    if (contains_straight(bb->rank_mask, four_fingers, shortcut, mobius_wrap, legacy_wrap))
+    {
+        hand_types.STRAIGHT = 1;
+    }
+
+    // Flush
+    if (contains_flush(bb->suit_counts, straight_size(four_fingers), smeared))
+    {
+        hand_types.FLUSH = 1;
+    }
+
+    // Full House
+    if (n_of_a_kind >= 3 && hand_contains_full_house(bb))
+    {
+        hand_types.FULL_HOUSE = 1;
+    }
+
+    // 4 OAK
+    if (n_of_a_kind >= 4)
+    {
+        hand_types.FOUR_OF_A_KIND = 1;
+    }
+
+    // Straight Flush
+    if (hand_types.STRAIGHT && hand_types.FLUSH)
+    {
+        hand_types.STRAIGHT_FLUSH = 1;
+    }
+
+    // Royal Flush
+    if (hand_types.STRAIGHT_FLUSH)
+    {
+        if ((bb->rank_mask & ROYAL_RANK_MASK) == ROYAL_RANK_MASK)
+        {
+            hand_types.ROYAL_FLUSH = 1;
+        }
+    }
+
+    // 5 OAK
+    if (n_of_a_kind >= 5)
+    {
+        hand_types.FIVE_OF_A_KIND = 1;
+    }
+
+    // Flush House and Five
+    if (hand_types.FLUSH)
+    {
+        if (hand_types.FULL_HOUSE)
+        {
+            hand_types.FLUSH_HOUSE = 1;
+        }
+
+        if (hand_types.FIVE_OF_A_KIND)
+        {
+            hand_types.FLUSH_FIVE = 1;
+        }
+    }
+
+    return hand_types;
+}
+
+// One evaluator per rule combination, the legacy wrap rule is rare enough to stay a runtime check
+#define DEF_HAND_EVAL_VARIANT(name, four_fingers, shortcut, smeared, mobius_wrap)                \
+    static ContainedHandTypes hand_eval_##name(const HandBitboard* bb, const RuleSet* rules)    \
+    {                                                                                           \
+        bool legacy_wrap = rules->legacy_wrap;                                                  \
+        return contained_types(bb, four_fingers, shortcut, smeared, mobius_wrap, legacy_wrap);  \
+    }
+#include "def_hand_eval_variants.h"
+#undef DEF_HAND_EVAL_VARIANT
+
+static const HandEvalFunc hand_eval_variants[HAND_EVAL_NUM_VARIANTS] = {
+#define DEF_HAND_EVAL_VARIANT(name, four_fingers, shortcut, smeared, mobius_wrap)                \
+    [HAND_EVAL_VARIANT_IDX(four_fingers, shortcut, smeared, mobius_wrap)] = hand_eval_##name,
+#include "def_hand_eval_variants.h"
+#undef DEF_HAND_EVAL_VARIANT
+};
+
+HandEvalFunc hand_eval_select_variant(const RuleSet* rules)
+{
+    return hand_eval_variants[HAND_EVAL_VARIANT_IDX(
+        rules->straight_size == STRAIGHT_AND_FLUSH_SIZE_FOUR_FINGERS,
+        rules->shortcut,
+        rules->smeared,
+        rules->mobius_wrap
+    )];
+}
+
+ContainedHandTypes hand_eval_contained_types(const HandBitboard* bb, const RuleSet* rules)
+{
+    return hand_eval_select_variant(rules)(bb, rules);
+}
+
+ContainedHandTypes hand_eval_cards(Card** cards, int count, const RuleSet* rules)
+{
+    HandBitboard bb;
+    hand_bitboard_from_cards(&bb, cards, count);
+    return hand_eval_contained_types(&bb, rules);
+}
+
+// Ranks of the longest straight in a rank mask, or 0 if it is shorter than the straight size.
+// Ties go to the highest ending rank and to the adjacent rank over a Shortcut skip.
+static uint16_t straight_scoring_ranks(uint16_t rank_mask, const RuleSet* rules)
+{
+    uint8_t longest_at[NUM_RANKS] = {0};
+    int8_t parent[NUM_RANKS];
+    bool mobius = rules->mobius_wrap;
+    int ace_low_len = (rank_mask >> ACE) & 0x1;
+    int limit = mobius ? NUM_RANKS * 2 : NUM_RANKS;
+
+    for (int r = 0; r < NUM_RANKS; r++)
+        parent[r] = -1;
+
+    for (int i = 0; i < limit; i++)
+    {
+        int r = i % NUM_RANKS;
+        if (!((rank_mask >> r) & 0x1))
+            continue;
+
+        int prev1, prev2 = 0;
+        int parent1, parent2 = -1;
+
+        if (r == TWO)
+        {
+            prev1 = mobius ? longest_at[ACE] : ace_low_len;
+            parent1 = ACE;
+            if (rules->shortcut && mobius)
+            {
+                prev2 = longest_at[KING];
+                parent2 = KING;
+            }
+        }
+        else if (r == ACE)
+        {
+            prev1 = longest_at[KING];
+            parent1 = KING;
+            if (rules->shortcut)
+            {
+                prev2 = longest_at[QUEEN];
+                parent2 = QUEEN;
+            }
+        }
+        else
+        {
+            prev1 = longest_at[r - 1];
+            parent1 = r - 1;
+            if (rules->shortcut)
+            {
+                prev2 = (r == THREE) ? (mobius ? longest_at[ACE] : ace_low_len) : longest_at[r - 2];
+                parent2 = (r == THREE) ? ACE : r - 2;
+            }
+        }
+
+        if (prev1 >= prev2)
+        {
+            longest_at[r] = 1 + prev1;
+            parent[r] = parent1;
+        }
+        else
+        {
+            longest_at[r] = 1 + prev2;
+            parent[r] = parent2;
+        }
+    }
+
+    int best_len = 0;
+    int rank = -1;
+    for (int r = 0; r < NUM_RANKS; r++)
+    {
+        if (longest_at[r] >= best_len)
+        {
+            best_len = longest_at[r];
+            rank = r;
+        }
+    }
+
+    if (best_len < rules->straight_size)
+        return 0;
+
+    uint16_t straight_ranks = 0;
+    for (; best_len > 0 && rank != -1; best_len--)
+    {
+        straight_ranks |= 1 << rank;
+        rank = parent[rank];
+    }
+    return straight_ranks;
+}
+
+// Suits of the flush as a mask of suit bits, or 0 if there is none
+static uint8_t flush_scoring_suits(const HandBitboard* bb, const RuleSet* rules)
+{
+    if (rules->smeared)
+    {
+        uint8_t red = hand_bitboard_suit_count(bb, HEARTS) + hand_bitboard_suit_count(bb, DIAMONDS);
+        uint8_t black = hand_bitboard_suit_count(bb, SPADES) + hand_bitboard_suit_count(bb, CLUBS);
+        uint8_t suits = 0;
+
+        if (red >= rules->straight_size)
+            suits |= (1 << HEARTS) | (1 << DIAMONDS);
+        if (black >= rules->straight_size)
+            suits |= (1 << SPADES) | (1 << CLUBS);
+        return suits;
+    }
+
+    int best_suit = 0;
+    for (int suit = 1; suit < NUM_SUITS; suit++)
+    {
+        if (hand_bitboard_suit_count(bb, suit) > hand_bitboard_suit_count(bb, best_suit))
+            best_suit = suit;
+    }
+    return hand_bitboard_suit_count(bb, best_suit) >= rules->straight_size ? 1 << best_suit : 0;
+}
+
+// Single walk over the cards turning scoring ranks and suits into a per-card mask
+static uint8_t cards_scoring_mask(
+    Card** cards,
+    int count,
+    uint16_t scoring_ranks,
+    uint8_t scoring_suits,
+    bool first_card_only
+)
+{
+    uint8_t scoring_mask = 0;
+    for (int i = 0; i < count; i++)
+    {
+        if (!cards[i])
+            continue;
+
+        if (((scoring_ranks >> cards[i]->rank) & 0x1) || ((scoring_suits >> cards[i]->suit) & 0x1))
+        {
+            scoring_mask |= 1 << i;
+            if (first_card_only)
+                break;
+        }
+    }
+    return scoring_mask;
+}
+
+uint8_t hand_eval_scoring_mask(
+    const HandBitboard* bb,
+    Card** cards,
+    int count,
+    enum HandType hand_type,
+    const RuleSet* rules
+)
+{
+    uint16_t scoring_ranks = 0;
+    uint8_t scoring_suits = 0;
+    bool first_card_only = false;
+
+    switch (hand_type)
+    {
+        case NONE:
+            return 0;
+        case HIGH_CARD:
+            scoring_ranks = bb->rank_mask ? 1 << (31 - __builtin_clz(bb->rank_mask)) : 0;
+            first_card_only = true;
+            break;
+        case PAIR:
+            /* FALL THROUGH */
+        case TWO_PAIR:
+            scoring_ranks = rank_hist_ranks_at_least(bb->rank_counts, 2);
+            break;
+        case THREE_OF_A_KIND:
+            scoring_ranks = rank_hist_ranks_at_least(bb->rank_counts, 3);
+            break;
+        case FOUR_OF_A_KIND:
+            scoring_ranks = rank_hist_ranks_at_least(bb->rank_counts, 4);
+            break;
+        case STRAIGHT:
+            /* FALL THROUGH */
+        case FLUSH:
+            /* FALL THROUGH */
+        case STRAIGHT_FLUSH:
+            /* FALL THROUGH */
+        case ROYAL_FLUSH:
+            if (hand_type != STRAIGHT)
+            {
+                scoring_suits = flush_scoring_suits(bb, rules);
+            }
+            if (hand_type != FLUSH)
+            {
+                // With Four Fingers a straight can hold a pair, every card sharing a rank with a
+                // scoring card scores too (e.g. AA234 scores all five cards)
+                scoring_ranks = straight_scoring_ranks(bb->rank_mask, rules);
+                for (int suit = 0; suit < NUM_SUITS; suit++)
+                {
+                    if ((scoring_suits >> suit) & 0x1)
+                        scoring_ranks |= bb->suit_ranks[suit];
+                }
+            }
+            break;
+        case FULL_HOUSE:
+            /* FALL THROUGH */
+        case FIVE_OF_A_KIND:
+            /* FALL THROUGH */
+        case FLUSH_HOUSE:
+            /* FALL THROUGH */
+        case FLUSH_FIVE:
+            scoring_ranks = ALL_RANKS_MASK;
+            break;
+    }
+
+    return cards_scoring_mask(cards, count, scoring_ranks, scoring_suits, first_card_only);
+}
+
+// clang-format off
+static const HandValues hand_base_values[] = {
+    {.chips = 0,   .mult = 0,  .display_name = NULL     }, // NONE
+    {.chips = 5,   .mult = 1,  .display_name = "HIGH C" }, // HIGH_CARD
+    {.chips = 10,  .mult = 2,  .display_name = "PAIR"   }, // PAIR
+    {.chips = 20,  .mult = 2,  .display_name = "2 PAIR" }, // TWO_PAIR
+    {.chips = 30,  .mult = 3,  .display_name = "3 OAK"  }, // THREE_OF_A_KIND
+    {.chips = 30,  .mult = 4,  .display_name = "STRT"   }, // STRAIGHT
+    {.chips = 35,  .mult = 4,  .display_name = "FLUSH"  }, // FLUSH
+    {.chips = 40,  .mult = 4,  .display_name = "FULL H" }, // FULL_HOUSE
+    {.chips = 60,  .mult = 7,  .display_name = "4 OAK"  }, // FOUR_OF_A_KIND
+    {.chips = 100, .mult = 8,  .display_name = "STRT F" }, // STRAIGHT_FLUSH
+    {.chips = 100, .mult = 8,  .display_name = "ROYAL F"}, // ROYAL_FLUSH
+    {.chips = 120, .mult = 12, .display_name = "5 OAK"  }, // FIVE_OF_A_KIND
+    {.chips = 140, .mult = 14, .display_name = "FLUSH H"}, // FLUSH_HOUSE
+    {.chips = 160, .mult = 16, .display_name = "FLUSH 5"}  // FLUSH_FIVE
+};
+// clang-format on
+
+const HandValues* hand_eval_base_values(enum HandType hand_type)
+{
+    return &hand_base_values[hand_type];
+}
+
+enum HandType hand_eval_highest_type(ContainedHandTypes contained_types)
+{
+    if (contained_types.value == 0)
+    {
+        return NONE;
+    }
+
+    // ContainedHandTypes is ordered the same way as the HandType enum, offset by one for NONE,
+    // so the highest set bit is the most powerful hand
+    return (enum HandType)(32 - __builtin_clz(contained_types.value));
+}
+
+// Looks up the hand class entry of a bitboard. The ranks are walked in ascending order so the
+// multiset key comes out sorted for free, cards past HAND_CLASS_MAX_CARDS are ignored.
+static inline uint32_t hand_class_entry(const HandBitboard* bb, bool* out_flush)
+{
+    uint16_t rank_mask = bb->rank_mask;
+    int num_cards = 0;
+    int key = 0;
+
+    while (rank_mask)
+    {
+        int rank = __builtin_ctz(rank_mask);
+        int rank_count = rank_hist_count(bb->rank_counts, rank);
+
+        for (; rank_count > 0 && num_cards < HAND_CLASS_MAX_CARDS; rank_count--)
+        {
+            key += hand_class_key_weights[num_cards++][rank];
+        }
+        rank_mask &= rank_mask - 1;
+    }
+
+    *out_flush = num_cards == HAND_CLASS_MAX_CARDS &&
+                 contains_flush(bb->suit_counts, HAND_CLASS_MAX_CARDS, false);
+    return hand_class_lut[hand_class_size_offsets[num_cards] + key];
+}
+
+enum HandType hand_eval_vanilla_type(const HandBitboard* bb)
+{
+    if (bb->rank_mask == 0)
+    {
+        return NONE;
+    }
+
+    bool flush;
+    uint32_t entry = hand_class_entry(bb, &flush);
+    if (flush)
+    {
+        entry >>= HAND_CLASS_FLUSH_TYPE_SHIFT;
+    }
+    return (enum HandType)(entry & HAND_CLASS_TYPE_MASK);
+}
+
+uint8_t hand_eval_vanilla_scoring_mask(const HandBitboard* bb, Card** cards, int count)
+{
+    if (bb->rank_mask == 0)
+    {
+        return 0;
+    }
+
+    bool flush;
+    uint32_t entry = hand_class_entry(bb, &flush);
+    enum HandType hand_type = entry & HAND_CLASS_TYPE_MASK;
+    uint16_t scoring_ranks = (entry >> HAND_CLASS_SCORING_RANKS_SHIFT) & ALL_RANKS_MASK;
+
+    // Every card of a five card flush scores, unless the ranks alone make a stronger hand
+    if (flush && ((entry >> HAND_CLASS_FLUSH_TYPE_SHIFT) & HAND_CLASS_TYPE_MASK) != hand_type)
+    {
+        return cards_scoring_mask(cards, count, ALL_RANKS_MASK, 0, false);
+    }
+    return cards_scoring_mask(cards, count, scoring_ranks, 0, hand_type == HIGH_CARD);
+}
@@ -0,0 +1,119 @@
+#include "hand_memo.h"
+
+// Key layout: bits 0-51 hold the cards (bit suit * NUM_RANKS + rank), the rule bits sit above
+// them and the top bit marks the entry as used so that the empty key never matches
+#define HAND_MEMO_RULES_SHIFT 52
+#define HAND_MEMO_KEY_VALID   (1ULL << 63)
+#define HAND_MEMO_INDEX_BITS  6
+
+_Static_assert(
+    HAND_MEMO_NUM_ENTRIES == 1 << HAND_MEMO_INDEX_BITS,
+    "HAND_MEMO_NUM_ENTRIES must match HAND_MEMO_INDEX_BITS"
+);
+
+typedef struct HandMemoEntry
+{
+    uint64_t key;
+    ContainedHandTypes contained_types;
+    uint8_t hand_type;
+} HandMemoEntry;
+
+// Plain .bss, which the GBA linker script places in IWRAM
+static HandMemoEntry hand_memo_entries[HAND_MEMO_NUM_ENTRIES];
+static HandMemoStats hand_memo_stats;
+
+// Only the rules that change the hand types go into the key, Pareidolia doesn't
+static inline uint64_t rule_bits(const RuleSet* rules)
+{
+    uint64_t bits = HAND_EVAL_VARIANT_IDX(
+        rules->straight_size == STRAIGHT_AND_FLUSH_SIZE_FOUR_FINGERS,
+        rules->shortcut,
+        rules->smeared,
+        rules->mobius_wrap
+    );
+    return bits | (rules->legacy_wrap ? HAND_EVAL_NUM_VARIANTS : 0);
+}
+
+static inline int num_cards_in(const HandBitboard* bb)
+{
+    // Sum the four suit count bytes into the top byte
+    return (uint32_t)(bb->suit_counts * 0x01010101U) >> 24;
+}
+
+static inline uint64_t card_set_of(const HandBitboard* bb)
+{
+    uint64_t card_set = 0;
+    for (int suit = 0; suit < NUM_SUITS; suit++)
+    {
+        card_set |= (uint64_t)bb->suit_ranks[suit] << (suit * NUM_RANKS);
+    }
+    return card_set;
+}
+
+static inline int popcount64(uint64_t x)
+{
+    return __builtin_popcount((uint32_t)x) + __builtin_popcount((uint32_t)(x >> 32));
+}
+
+static inline int index_of(uint64_t key)
+{
+    // Fibonacci hashing of the folded key, the top bits are the best mixed
+    uint32_t folded = (uint32_t)key ^ (uint32_t)(key >> 32);
+    return (uint32_t)(folded * 0x9E3779B1U) >> (32 - HAND_MEMO_INDEX_BITS);
+}
+
+ContainedHandTypes hand_memo_eval(
+    const HandBitboard* bb,
+    const RuleSet* rules,
+    HandEvalFunc hand_eval,
+    enum HandType* out_hand_type
+)
+{
+    uint64_t card_set = card_set_of(bb);
+    bool cacheable = popcount64(card_set) == num_cards_in(bb);
+    uint64_t key = card_set | (rule_bits(rules) << HAND_MEMO_RULES_SHIFT) | HAND_MEMO_KEY_VALID;
+    HandMemoEntry* entry = &hand_memo_entries[index_of(key)];
+
+    if (cacheable && entry->key == key)
+    {
+        hand_memo_stats.hits++;
+        if (out_hand_type)
+            *out_hand_type = entry->hand_type;
+        return entry->contained_types;
+    }
+
+    hand_memo_stats.misses++;
+
+    ContainedHandTypes contained_types = hand_eval(bb, rules);
+    enum HandType hand_type = hand_eval_highest_type(contained_types);
+
+    if (cacheable)
+    {
+        entry->key = key;
+        entry->contained_types = contained_types;
+        entry->hand_type = hand_type;
+    }
+
+    if (out_hand_type)
+        *out_hand_type = hand_type;
+    return contained_types;
+}
+
+void hand_memo_clear(void)
+{
+    for (int i = 0; i < HAND_MEMO_NUM_ENTRIES; i++)
+    {
+        hand_memo_entries[i].key = 0;
+    }
+}
+
+const HandMemoStats* hand_memo_get_stats(void)
+{
+    return &hand_memo_stats;
+}
+
+void hand_memo_reset_stats(void)
+{
+    hand_memo_stats.hits = 0;
+    hand_memo_stats.misses = 0;
+}
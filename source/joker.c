@@ -97,10 +97,11 @@ Joker* joker_new(u8 id)
     joker->rarity = jinfo->rarity;
     joker->scoring_state = 0;
     joker->persistent_state = 0;
+    joker->copied_joker = NULL;
 
     // initialize persistent Joker data if needed
-    JokerEffect* joker_effect = NULL;
-    jinfo->joker_effect_func(joker, NULL, JOKER_EVENT_ON_JOKER_CREATED, &joker_effect);
+    JokerEffect joker_effect = {0};
+    joker_get_score_effect(joker, NULL, JOKER_EVENT_ON_JOKER_CREATED, &joker_effect);
 
     return joker;
 }
@@ -115,16 +116,32 @@ u32 joker_get_score_effect(
     Joker* joker,
     Card* scored_card,
     enum JokerEvent joker_event,
-    JokerEffect** joker_effect
+    JokerEffect* joker_effect
 )
 {
     const JokerInfo* jinfo = get_joker_registry_entry(joker->id);
-    if (!jinfo)
+    if (!jinfo || !(jinfo->event_mask & JOKER_EVENT_BIT(joker_event)))
         return JOKER_EFFECT_FLAG_NONE;
 
     return jinfo->joker_effect_func(joker, scored_card, joker_event, joker_effect);
 }
 
+u16 joker_get_event_mask(const Joker* joker)
+{
+    const JokerInfo* jinfo = get_joker_registry_entry(joker->id);
+    if (!jinfo)
+        return 0;
+
+    if (joker->id != BLUEPRINT_JOKER_ID && joker->id != BRAINSTORM_JOKER_ID)
+        return jinfo->event_mask;
+
+    if (joker->copied_joker == NULL)
+        return 0;
+
+    const JokerInfo* copied_jinfo = get_joker_registry_entry(joker->copied_joker->id);
+    return copied_jinfo ? jinfo->event_mask & copied_jinfo->event_mask : 0;
+}
+
 int joker_get_sell_value(const Joker* joker)
 {
     if (joker == NULL)
@@ -251,26 +268,59 @@ bool joker_object_score(
         return false;
     }
 
-    JokerEffect* joker_effect = NULL;
+    // Events that don't concern a card are scored with card_object = NULL
+    Card* scored_card = (card_object != NULL) ? card_object->card : NULL;
+
+    JokerEffect joker_effect = {0};
     u32 effect_flags_ret =
-        joker_get_score_effect(joker_object->joker, card_object->card, joker_event, &joker_effect);
+        joker_get_score_effect(joker_object->joker, scored_card, joker_event, &joker_effect);
 
     if (effect_flags_ret == JOKER_EFFECT_FLAG_NONE)
     {
         return false;
     }
 
-    u32 chips = get_chips();
-    u32 mult = get_mult();
-    int money = get_money();
+    JokerScoreState state = {
+        .chips = get_chips(),
+        .mult = get_mult(),
+        .money = get_money(),
+    };
+    joker_apply_effect(&state, &joker_effect, effect_flags_ret);
 
+    // Update values
+    set_chips(state.chips);
+    set_mult(state.mult);
+    set_money(state.money);
     if (effect_flags_ret & JOKER_EFFECT_FLAG_RETRIGGER)
     {
-        set_retrigger(joker_effect->retrigger);
+        set_retrigger(state.retrigger);
     }
 
-    // joker_effect.message will have been set if the Joker had anything custom to say
+    // this will start the Joker expire animation
+    if (effect_flags_ret & JOKER_EFFECT_FLAG_EXPIRE && joker_effect.expire)
+    {
+        list_push_back(get_expired_jokers_list(), joker_object);
+    }
 
+    joker_object_present_effect(
+        joker_object,
+        card_object,
+        joker_event,
+        &joker_effect,
+        effect_flags_ret
+    );
+
+    return true;
+}
+
+void joker_object_present_effect(
+    JokerObject* joker_object,
+    CardObject* card_object,
+    enum JokerEvent joker_event,
+    const JokerEffect* joker_effect,
+    u32 effect_flags
+)
+{
     int cursorPosX = TILE_SIZE; // Offset of one tile to better center the text on the card
     int cursorPosY = 0;
     if (joker_event == JOKER_EVENT_ON_CARD_HELD)
@@ -286,35 +336,31 @@ bool joker_object_score(
         cursorPosY = JOKER_SCORE_TEXT_Y;
     }
 
-    mm_word sfx_id;
-    if (effect_flags_ret & JOKER_EFFECT_FLAG_CHIPS)
+    mm_word sfx_id = UNDEFINED; // No sound unless the effect changes the score
+    if (effect_flags & JOKER_EFFECT_FLAG_CHIPS)
     {
-        chips = u32_protected_add(chips, joker_effect->chips);
         char score_buffer[INT_MAX_DIGITS + 2]; // For '+' and null terminator
         snprintf(score_buffer, sizeof(score_buffer), "+%lu", joker_effect->chips);
         set_and_shift_text(score_buffer, &cursorPosX, &cursorPosY, TTE_BLUE_PB);
         sfx_id = SFX_CHIPS_GENERIC; // The joker chips effect is "generic"
     }
-    if (effect_flags_ret & JOKER_EFFECT_FLAG_MULT)
+    if (effect_flags & JOKER_EFFECT_FLAG_MULT)
     {
-        mult = u32_protected_add(mult, joker_effect->mult);
         char score_buffer[INT_MAX_DIGITS + 2];
         snprintf(score_buffer, sizeof(score_buffer), "+%lu", joker_effect->mult);
         set_and_shift_text(score_buffer, &cursorPosX, &cursorPosY, TTE_RED_PB);
         sfx_id = SFX_MULT;
     }
-    // if xmult is zero, DO NOT multiply by it
-    if (effect_flags_ret & JOKER_EFFECT_FLAG_XMULT && joker_effect->xmult > 0)
+    // an xmult of zero was not applied, so it isn't shown either
+    if (effect_flags & JOKER_EFFECT_FLAG_XMULT && joker_effect->xmult > 0)
     {
-        mult = u32_protected_mult(mult, joker_effect->xmult);
         char score_buffer[INT_MAX_DIGITS + 2];
         snprintf(score_buffer, sizeof(score_buffer), "X%lu", joker_effect->xmult);
         set_and_shift_text(score_buffer, &cursorPosX, &cursorPosY, TTE_RED_PB);
         sfx_id = SFX_XMULT;
     }
-    if (effect_flags_ret & JOKER_EFFECT_FLAG_MONEY)
+    if (effect_flags & JOKER_EFFECT_FLAG_MONEY)
     {
-        money += joker_effect->money;
         char score_buffer[INT_MAX_DIGITS + 2];
         snprintf(score_buffer, sizeof(score_buffer), "%d$", joker_effect->money);
         set_and_shift_text(score_buffer, &cursorPosX, &cursorPosY, TTE_YELLOW_PB);
@@ -322,30 +368,21 @@ bool joker_object_score(
     }
     // custom message for Jokers (including retriggers where Jokers will say "Again!")
     // joker_effect->message will have been set if the Joker had anything custom to say
-    if (effect_flags_ret & JOKER_EFFECT_FLAG_MESSAGE)
+    if (effect_flags & JOKER_EFFECT_FLAG_MESSAGE)
     {
         set_and_shift_text(joker_effect->message, &cursorPosX, &cursorPosY, TTE_WHITE_PB);
     }
-    // this will start the Joker expire animation
-    if (effect_flags_ret & JOKER_EFFECT_FLAG_EXPIRE && joker_effect->expire)
+    if (effect_flags & JOKER_EFFECT_FLAG_EXPIRE && joker_effect->expire)
     {
         joker_object_shake(joker_object, UNDEFINED);
-        list_push_back(get_expired_jokers_list(), joker_object);
     }
 
-    // Update values
-    set_chips(chips);
-    set_mult(mult);
-    set_money(money);
-
     // Update displays
     display_chips();
     display_mult();
     display_money();
 
     joker_object_shake(joker_object, sfx_id);
-
-    return true;
 }
 
 Sprite* joker_object_get_sprite(JokerObject* joker_object)
@@ -23,364 +23,376 @@ extern enum HandType* get_hand_type(void); // Bring in the hand type fetcher, Su
         return JOKER_EFFECT_FLAG_NONE;                       \
     }
 
-static JokerEffect shared_joker_effect = {0};
-
 // Joker Effect functions
 static u32 joker_effect_noop(
     Joker* joker,
     Card* scored_card,
     enum JokerEvent joker_event,
-    JokerEffect** joker_effect
+    JokerEffect* joker_effect
 );
 static u32 default_joker_effect(
     Joker* joker,
     Card* scored_card,
     enum JokerEvent joker_event,
-    JokerEffect** joker_effect
+    JokerEffect* joker_effect
 );
 static u32 sinful_joker_effect(
     Card* scored_card,
     u8 sinful_suit,
     enum JokerEvent joker_event,
-    JokerEffect** joker_effect
+    JokerEffect* joker_effect
 );
 static u32 greedy_joker_effect(
     Joker* joker,
     Card* scored_card,
     enum JokerEvent joker_event,
-    JokerEffect** joker_effect
+    JokerEffect* joker_effect
 );
 static u32 lusty_joker_effect(
     Joker* joker,
     Card* scored_card,
     enum JokerEvent joker_event,
-    JokerEffect** joker_effect
+    JokerEffect* joker_effect
 );
 static u32 wrathful_joker_effect(
     Joker* joker,
     Card* scored_card,
     enum JokerEvent joker_event,
-    JokerEffect** joker_effect
+    JokerEffect* joker_effect
 );
 static u32 gluttonous_joker_effect(
     Joker* joker,
     Card* scored_card,
     enum JokerEvent joker_event,
-    JokerEffect** joker_effect
+    JokerEffect* joker_effect
 );
 static u32 jolly_joker_effect(
     Joker* joker,
     Card* scored_card,
     enum JokerEvent joker_event,
-    JokerEffect** joker_effect
+    JokerEffect* joker_effect
 );
 static u32 zany_joker_effect(
     Joker* joker,
     Card* scored_card,
     enum JokerEvent joker_event,
-    JokerEffect** joker_effect
+    JokerEffect* joker_effect
 );
 static u32 mad_joker_effect(
     Joker* joker,
     Card* scored_card,
     enum JokerEvent joker_event,
-    JokerEffect** joker_effect
+    JokerEffect* joker_effect
 );
 static u32 crazy_joker_effect(
     Joker* joker,
     Card* scored_card,
     enum JokerEvent joker_event,
-    JokerEffect** joker_effect
+    JokerEffect* joker_effect
 );
 static u32 droll_joker_effect(
     Joker* joker,
     Card* scored_card,
     enum JokerEvent joker_event,
-    JokerEffect** joker_effect
+    JokerEffect* joker_effect
 );
 static u32 sly_joker_effect(
     Joker* joker,
     Card* scored_card,
     enum JokerEvent joker_event,
-    JokerEffect** joker_effect
+    JokerEffect* joker_effect
 );
 static u32 wily_joker_effect(
     Joker* joker,
     Card* scored_card,
     enum JokerEvent joker_event,
-    JokerEffect** joker_effect
+    JokerEffect* joker_effect
 );
 static u32 clever_joker_effect(
     Joker* joker,
     Card* scored_card,
     enum JokerEvent joker_event,
-    JokerEffect** joker_effect
+    JokerEffect* joker_effect
 );
 static u32 devious_joker_effect(
     Joker* joker,
     Card* scored_card,
     enum JokerEvent joker_event,
-    JokerEffect** joker_effect
+    JokerEffect* joker_effect
 );
 static u32 crafty_joker_effect(
     Joker* joker,
     Card* scored_card,
     enum JokerEvent joker_event,
-    JokerEffect** joker_effect
+    JokerEffect* joker_effect
 );
 static u32 half_joker_effect(
     Joker* joker,
     Card* scored_card,
     enum JokerEvent joker_event,
-    JokerEffect** joker_effect
+    JokerEffect* joker_effect
 );
 static u32 joker_stencil_effect(
     Joker* joker,
     Card* scored_card,
     enum JokerEvent joker_event,
-    JokerEffect** joker_effect
+    JokerEffect* joker_effect
 );
 static u32 misprint_joker_effect(
     Joker* joker,
     Card* scored_card,
     enum JokerEvent joker_event,
-    JokerEffect** joker_effect
+    JokerEffect* joker_effect
 );
 static u32 walkie_talkie_joker_effect(
     Joker* joker,
     Card* scored_card,
     enum JokerEvent joker_event,
-    JokerEffect** joker_effect
+    JokerEffect* joker_effect
 );
 static u32 fibonnaci_joker_effect(
     Joker* joker,
     Card* scored_card,
     enum JokerEvent joker_event,
-    JokerEffect** joker_effect
+    JokerEffect* joker_effect
 );
 static u32 banner_joker_effect(
     Joker* joker,
     Card* scored_card,
     enum JokerEvent joker_event,
-    JokerEffect** joker_effect
+    JokerEffect* joker_effect
 );
 static u32 mystic_summit_joker_effect(
     Joker* joker,
     Card* scored_card,
     enum JokerEvent joker_event,
-    JokerEffect** joker_effect
+    JokerEffect* joker_effect
 );
 static u32 blackboard_joker_effect(
     Joker* joker,
     Card* scored_card,
     enum JokerEvent joker_event,
-    JokerEffect** joker_effect
+    JokerEffect* joker_effect
 );
 static u32 blue_joker_effect(
     Joker* joker,
     Card* scored_card,
     enum JokerEvent joker_event,
-    JokerEffect** joker_effect
+    JokerEffect* joker_effect
 );
 static u32 raised_fist_joker_effect(
     Joker* joker,
     Card* scored_card,
     enum JokerEvent joker_event,
-    JokerEffect** joker_effect
+    JokerEffect* joker_effect
 );
 static u32 reserved_parking_joker_effect(
     Joker* joker,
     Card* scored_card,
     enum JokerEvent joker_event,
-    JokerEffect** joker_effect
+    JokerEffect* joker_effect
 );
 static u32 business_card_joker_effect(
     Joker* joker,
     Card* scored_card,
     enum JokerEvent joker_event,
-    JokerEffect** joker_effect
+    JokerEffect* joker_effect
 );
 static u32 scholar_joker_effect(
     Joker* joker,
     Card* scored_card,
     enum JokerEvent joker_event,
-    JokerEffect** joker_effect
+    JokerEffect* joker_effect
 );
 static u32 scary_face_joker_effect(
     Joker* joker,
     Card* scored_card,
     enum JokerEvent joker_event,
-    JokerEffect** joker_effect
+    JokerEffect* joker_effect
 );
 static u32 abstract_joker_effect(
     Joker* joker,
     Card* scored_card,
     enum JokerEvent joker_event,
-    JokerEffect** joker_effect
+    JokerEffect* joker_effect
 );
 static u32 bull_joker_effect(
     Joker* joker,
     Card* scored_card,
     enum JokerEvent joker_event,
-    JokerEffect** joker_effect
+    JokerEffect* joker_effect
 );
 static u32 smiley_face_joker_effect(
     Joker* joker,
     Card* scored_card,
     enum JokerEvent joker_event,
-    JokerEffect** joker_effect
+    JokerEffect* joker_effect
 );
 static u32 even_steven_joker_effect(
     Joker* joker,
     Card* scored_card,
     enum JokerEvent joker_event,
-    JokerEffect** joker_effect
+    JokerEffect* joker_effect
 );
 static u32 odd_todd_joker_effect(
     Joker* joker,
     Card* scored_card,
     enum JokerEvent joker_event,
-    JokerEffect** joker_effect
+    JokerEffect* joker_effect
 );
 static u32 acrobat_joker_effect(
     Joker* joker,
     Card* scored_card,
     enum JokerEvent joker_event,
-    JokerEffect** joker_effect
+    JokerEffect* joker_effect
 );
 static u32 hanging_chad_joker_effect(
     Joker* joker,
     Card* scored_card,
     enum JokerEvent joker_event,
-    JokerEffect** joker_effect
+    JokerEffect* joker_effect
 );
 static u32 the_duo_joker_effect(
     Joker* joker,
     Card* scored_card,
     enum JokerEvent joker_event,
-    JokerEffect** joker_effect
+    JokerEffect* joker_effect
 );
 static u32 the_trio_joker_effect(
     Joker* joker,
     Card* scored_card,
     enum JokerEvent joker_event,
-    JokerEffect** joker_effect
+    JokerEffect* joker_effect
 );
 static u32 the_family_joker_effect(
     Joker* joker,
     Card* scored_card,
     enum JokerEvent joker_event,
-    JokerEffect** joker_effect
+    JokerEffect* joker_effect
 );
 static u32 the_order_joker_effect(
     Joker* joker,
     Card* scored_card,
     enum JokerEvent joker_event,
-    JokerEffect** joker_effect
+    JokerEffect* joker_effect
 );
 static u32 the_tribe_joker_effect(
     Joker* joker,
     Card* scored_card,
     enum JokerEvent joker_event,
-    JokerEffect** joker_effect
+    JokerEffect* joker_effect
 );
 static u32 bootstraps_joker_effect(
     Joker* joker,
     Card* scored_card,
     enum JokerEvent joker_event,
-    JokerEffect** joker_effect
+    JokerEffect* joker_effect
 );
 static u32 shoot_the_moon_joker_effect(
     Joker* joker,
     Card* scored_card,
     enum JokerEvent joker_event,
-    JokerEffect** joker_effect
+    JokerEffect* joker_effect
 );
 static u32 photograph_joker_effect(
     Joker* joker,
     Card* scored_card,
     enum JokerEvent joker_event,
-    JokerEffect** joker_effect
+    JokerEffect* joker_effect
 );
 static u32 dusk_joker_effect(
     Joker* joker,
     Card* scored_card,
     enum JokerEvent joker_event,
-    JokerEffect** joker_effect
+    JokerEffect* joker_effect
 );
 static u32 blueprint_brainstorm_joker_effect(
     Joker* joker,
     Card* scored_card,
     enum JokerEvent joker_event,
-    JokerEffect** joker_effect
+    JokerEffect* joker_effect
 );
 static u32 hack_joker_effect(
     Joker* joker,
     Card* scored_card,
     enum JokerEvent joker_event,
-    JokerEffect** joker_effect
+    JokerEffect* joker_effect
 );
 static u32 seltzer_joker_effect(
     Joker* joker,
     Card* scored_card,
     enum JokerEvent joker_event,
-    JokerEffect** joker_effect
+    JokerEffect* joker_effect
 );
 static u32 sock_and_buskin_joker_effect(
     Joker* joker,
     Card* scored_card,
     enum JokerEvent joker_event,
-    JokerEffect** joker_effect
+    JokerEffect* joker_effect
 );
 static u32 golden_joker_effect(
     Joker* joker,
     Card* scored_card,
     enum JokerEvent joker_event,
-    JokerEffect** joker_effect
+    JokerEffect* joker_effect
 );
 static u32 gros_michel_joker_effect(
     Joker* joker,
     Card* scored_card,
     enum JokerEvent joker_event,
-    JokerEffect** joker_effect
+    JokerEffect* joker_effect
 );
 static u32 cavendish_joker_effect(
     Joker* joker, 
     Card* scored_card,
     enum JokerEvent joker_event,
-    JokerEffect** joker_effect
+    JokerEffect* joker_effect
 );
 static u32 supernova_joker_effect(
     Joker* joker, 
     Card* scored_card, 
     enum JokerEvent joker_event, 
-    JokerEffect** joker_effect
+    JokerEffect* joker_effect
 );
 static u32 green_joker_effect(
     Joker* joker, 
     Card* scored_card,
     enum JokerEvent joker_event,
-    JokerEffect** joker_effect
+    JokerEffect* joker_effect
 );
 static u32 square_joker_effect(
     Joker* joker, 
     Card* scored_card, 
     enum JokerEvent joker_event, 
-    JokerEffect** joker_effect
+    JokerEffect* joker_effect
 );
 static u32 smeared_joker_effect(
     Joker* joker, 
     Card* scored_card, 
     enum JokerEvent joker_event, 
-    JokerEffect** joker_effect
+    JokerEffect* joker_effect
 );
 static u32 flash_card_joker_effect(
     Joker* joker, 
     Card* scored_card, 
     enum JokerEvent joker_event, 
-    JokerEffect** joker_effect
+    JokerEffect* joker_effect
 );
 
+// Shorthands for the event masks of the registry
+#define NO_EVENTS     0
+#define ON_CREATED    JOKER_EVENT_BIT(JOKER_EVENT_ON_JOKER_CREATED)
+#define ON_PLAYED     JOKER_EVENT_BIT(JOKER_EVENT_ON_HAND_PLAYED)
+#define ON_SCORED     JOKER_EVENT_BIT(JOKER_EVENT_ON_CARD_SCORED)
+#define ON_SCORED_END JOKER_EVENT_BIT(JOKER_EVENT_ON_CARD_SCORED_END)
+#define ON_HELD       JOKER_EVENT_BIT(JOKER_EVENT_ON_CARD_HELD)
+#define INDEPENDENT   JOKER_EVENT_BIT(JOKER_EVENT_INDEPENDENT)
+#define ON_HAND_END   JOKER_EVENT_BIT(JOKER_EVENT_ON_HAND_SCORED_END)
+#define ON_ROUND_END  JOKER_EVENT_BIT(JOKER_EVENT_ON_ROUND_END)
+// Blueprint and Brainstorm react to whatever the joker they copy reacts to, except the events
+// blueprint_brainstorm_joker_effect() ignores
+#define COPYING       (JOKER_EVENT_MASK_ALL & ~(ON_CREATED | ON_HAND_END | ON_ROUND_END))
+
 // clang-format off
 /* The index of a joker in the registry matches its ID.
  * The joker sprites are matched by ID so the position in the registry
@@ -393,76 +405,87 @@ static u32 flash_card_joker_effect(
  */
 const JokerInfo joker_registry[] = 
 {
-    { COMMON_JOKER,    2, default_joker_effect              }, // DEFAULT_JOKER_ID = 0
-    { COMMON_JOKER,    5, greedy_joker_effect               }, // GREEDY_JOKER_ID  = 1
-    { COMMON_JOKER,    5, lusty_joker_effect                }, // etc...  2
-    { COMMON_JOKER,    5, wrathful_joker_effect             }, // 3
-    { COMMON_JOKER,    5, gluttonous_joker_effect           }, // 4
-    { COMMON_JOKER,    3, jolly_joker_effect                }, // 5
-    { COMMON_JOKER,    4, zany_joker_effect                 }, // 6
-    { COMMON_JOKER,    4, mad_joker_effect                  }, // 7
-    { COMMON_JOKER,    4, crazy_joker_effect                }, // 8
-    { COMMON_JOKER,    4, droll_joker_effect                }, // 9
-    { COMMON_JOKER,    3, sly_joker_effect                  }, // 10
-    { COMMON_JOKER,    4, wily_joker_effect                 }, // 11
-    { COMMON_JOKER,    4, clever_joker_effect               }, // 12
-    { COMMON_JOKER,    4, devious_joker_effect              }, // 13 
-    { COMMON_JOKER,    4, crafty_joker_effect               }, // 14
-    { COMMON_JOKER,    5, half_joker_effect                 }, // 15
-    { UNCOMMON_JOKER,  8, joker_stencil_effect              }, // 16
-    { COMMON_JOKER,    5, photograph_joker_effect,          }, // 17
-    { COMMON_JOKER,    4, walkie_talkie_joker_effect        }, // 18
-    { COMMON_JOKER,    5, banner_joker_effect               }, // 19
-    { UNCOMMON_JOKER,  6, blackboard_joker_effect           }, // 20
-    { COMMON_JOKER,    5, mystic_summit_joker_effect        }, // 21
-    { COMMON_JOKER,    4, misprint_joker_effect             }, // 22
-    { COMMON_JOKER,    4, even_steven_joker_effect          }, // 23
-    { COMMON_JOKER,    5, blue_joker_effect                 }, // 24
-    { COMMON_JOKER,    4, odd_todd_joker_effect             }, // 25
-    { UNCOMMON_JOKER,  7, joker_effect_noop,                }, // 26 Shortcut
-    { COMMON_JOKER,    4, business_card_joker_effect        }, // 27
-    { COMMON_JOKER,    4, scary_face_joker_effect           }, // 28
-    { UNCOMMON_JOKER,  7, bootstraps_joker_effect           }, // 29
-    { UNCOMMON_JOKER,  5, joker_effect_noop                 }, // 30 Pareidolia
-    { COMMON_JOKER,    6, reserved_parking_joker_effect     }, // 31
-    { COMMON_JOKER,    4, abstract_joker_effect             }, // 32
-    { UNCOMMON_JOKER,  6, bull_joker_effect                 }, // 33
-    { RARE_JOKER,      8, the_duo_joker_effect              }, // 34
-    { RARE_JOKER,      8, the_trio_joker_effect             }, // 35
-    { RARE_JOKER,      8, the_family_joker_effect           }, // 36
-    { RARE_JOKER,      8, the_order_joker_effect            }, // 37
-    { RARE_JOKER,      8, the_tribe_joker_effect            }, // 38
-    { RARE_JOKER,     10, blueprint_brainstorm_joker_effect }, // 39 Blueprint
-    { RARE_JOKER,     10, blueprint_brainstorm_joker_effect }, // 40 Brainstorm
-    { COMMON_JOKER,    5, raised_fist_joker_effect          }, // 41
-    { COMMON_JOKER,    4, smiley_face_joker_effect          }, // 42
-    { UNCOMMON_JOKER,  6, acrobat_joker_effect              }, // 43
-    { UNCOMMON_JOKER,  5, dusk_joker_effect                 }, // 44
-    { UNCOMMON_JOKER,  6, sock_and_buskin_joker_effect      }, // 45
-    { UNCOMMON_JOKER,  6, hack_joker_effect                 }, // 46
-    { COMMON_JOKER,    4, hanging_chad_joker_effect         }, // 47
-    { UNCOMMON_JOKER,  7, joker_effect_noop,                }, // 48 Four Fingers
-    { COMMON_JOKER,    4, scholar_joker_effect              }, // 49
-    { UNCOMMON_JOKER,  8, fibonnaci_joker_effect            }, // 50
-    { UNCOMMON_JOKER,  6, seltzer_joker_effect,             }, // 51
-    { COMMON_JOKER,    6, golden_joker_effect               }, // 52
-    { COMMON_JOKER,    5, gros_michel_joker_effect          }, // 53
-    { COMMON_JOKER,    5, cavendish_joker_effect            }, // 54 
-    { COMMON_JOKER,    5, supernova_joker_effect            }, // 55
-    { COMMON_JOKER,    4, green_joker_effect                }, // 56
-    { COMMON_JOKER,    4, square_joker_effect               }, // 57
-    { UNCOMMON_JOKER,  5, smeared_joker_effect              }, // 58
-    { UNCOMMON_JOKER,  4, flash_card_joker_effect           }, // 59
+    { COMMON_JOKER,    2, default_joker_effect,              INDEPENDENT                                          }, // DEFAULT_JOKER_ID = 0
+    { COMMON_JOKER,    5, greedy_joker_effect,               ON_SCORED                                            }, // GREEDY_JOKER_ID  = 1
+    { COMMON_JOKER,    5, lusty_joker_effect,                ON_SCORED                                            }, // etc...  2
+    { COMMON_JOKER,    5, wrathful_joker_effect,             ON_SCORED                                            }, // 3
+    { COMMON_JOKER,    5, gluttonous_joker_effect,           ON_SCORED                                            }, // 4
+    { COMMON_JOKER,    3, jolly_joker_effect,                INDEPENDENT                                          }, // 5
+    { COMMON_JOKER,    4, zany_joker_effect,                 INDEPENDENT                                          }, // 6
+    { COMMON_JOKER,    4, mad_joker_effect,                  INDEPENDENT                                          }, // 7
+    { COMMON_JOKER,    4, crazy_joker_effect,                INDEPENDENT                                          }, // 8
+    { COMMON_JOKER,    4, droll_joker_effect,                INDEPENDENT                                          }, // 9
+    { COMMON_JOKER,    3, sly_joker_effect,                  INDEPENDENT                                          }, // 10
+    { COMMON_JOKER,    4, wily_joker_effect,                 INDEPENDENT                                          }, // 11
+    { COMMON_JOKER,    4, clever_joker_effect,               INDEPENDENT                                          }, // 12
+    { COMMON_JOKER,    4, devious_joker_effect,              INDEPENDENT                                          }, // 13 
+    { COMMON_JOKER,    4, crafty_joker_effect,               INDEPENDENT                                          }, // 14
+    { COMMON_JOKER,    5, half_joker_effect,                 INDEPENDENT                                          }, // 15
+    { UNCOMMON_JOKER,  8, joker_stencil_effect,              INDEPENDENT                                          }, // 16
+    { COMMON_JOKER,    5, photograph_joker_effect,           ON_PLAYED | ON_SCORED                                }, // 17
+    { COMMON_JOKER,    4, walkie_talkie_joker_effect,        ON_SCORED                                            }, // 18
+    { COMMON_JOKER,    5, banner_joker_effect,               INDEPENDENT                                          }, // 19
+    { UNCOMMON_JOKER,  6, blackboard_joker_effect,           INDEPENDENT                                          }, // 20
+    { COMMON_JOKER,    5, mystic_summit_joker_effect,        INDEPENDENT                                          }, // 21
+    { COMMON_JOKER,    4, misprint_joker_effect,             INDEPENDENT                                          }, // 22
+    { COMMON_JOKER,    4, even_steven_joker_effect,          ON_SCORED                                            }, // 23
+    { COMMON_JOKER,    5, blue_joker_effect,                 INDEPENDENT                                          }, // 24
+    { COMMON_JOKER,    4, odd_todd_joker_effect,             ON_SCORED                                            }, // 25
+    { UNCOMMON_JOKER,  7, joker_effect_noop,                 NO_EVENTS                                            }, // 26 Shortcut
+    { COMMON_JOKER,    4, business_card_joker_effect,        ON_SCORED                                            }, // 27
+    { COMMON_JOKER,    4, scary_face_joker_effect,           ON_SCORED                                            }, // 28
+    { UNCOMMON_JOKER,  7, bootstraps_joker_effect,           INDEPENDENT                                          }, // 29
+    { UNCOMMON_JOKER,  5, joker_effect_noop,                 NO_EVENTS                                            }, // 30 Pareidolia
+    { COMMON_JOKER,    6, reserved_parking_joker_effect,     ON_HELD                                              }, // 31
+    { COMMON_JOKER,    4, abstract_joker_effect,             INDEPENDENT                                          }, // 32
+    { UNCOMMON_JOKER,  6, bull_joker_effect,                 INDEPENDENT                                          }, // 33
+    { RARE_JOKER,      8, the_duo_joker_effect,              INDEPENDENT                                          }, // 34
+    { RARE_JOKER,      8, the_trio_joker_effect,             INDEPENDENT                                          }, // 35
+    { RARE_JOKER,      8, the_family_joker_effect,           INDEPENDENT                                          }, // 36
+    { RARE_JOKER,      8, the_order_joker_effect,            INDEPENDENT                                          }, // 37
+    { RARE_JOKER,      8, the_tribe_joker_effect,            INDEPENDENT                                          }, // 38
+    { RARE_JOKER,     10, blueprint_brainstorm_joker_effect, COPYING                                              }, // 39 Blueprint
+    { RARE_JOKER,     10, blueprint_brainstorm_joker_effect, COPYING                                              }, // 40 Brainstorm
+    { COMMON_JOKER,    5, raised_fist_joker_effect,          ON_PLAYED | ON_HELD                                  }, // 41
+    { COMMON_JOKER,    4, smiley_face_joker_effect,          ON_SCORED                                            }, // 42
+    { UNCOMMON_JOKER,  6, acrobat_joker_effect,              INDEPENDENT                                          }, // 43
+    { UNCOMMON_JOKER,  5, dusk_joker_effect,                 ON_PLAYED | ON_SCORED_END                            }, // 44
+    { UNCOMMON_JOKER,  6, sock_and_buskin_joker_effect,      ON_PLAYED | ON_SCORED_END                            }, // 45
+    { UNCOMMON_JOKER,  6, hack_joker_effect,                 ON_PLAYED | ON_SCORED_END                            }, // 46
+    { COMMON_JOKER,    4, hanging_chad_joker_effect,         ON_PLAYED | ON_SCORED_END                            }, // 47
+    { UNCOMMON_JOKER,  7, joker_effect_noop,                 NO_EVENTS                                            }, // 48 Four Fingers
+    { COMMON_JOKER,    4, scholar_joker_effect,              ON_SCORED                                            }, // 49
+    { UNCOMMON_JOKER,  8, fibonnaci_joker_effect,            ON_SCORED                                            }, // 50
+    { UNCOMMON_JOKER,  6, seltzer_joker_effect,              ON_CREATED | ON_PLAYED | ON_SCORED_END | ON_HAND_END }, // 51
+    { COMMON_JOKER,    6, golden_joker_effect,               ON_ROUND_END                                         }, // 52
+    { COMMON_JOKER,    5, gros_michel_joker_effect,          INDEPENDENT | ON_ROUND_END                           }, // 53
+    { COMMON_JOKER,    5, cavendish_joker_effect,            INDEPENDENT | ON_ROUND_END                           }, // 54 
+    { COMMON_JOKER,    5, supernova_joker_effect,            INDEPENDENT                                          }, // 55
+    { COMMON_JOKER,    4, green_joker_effect,                ON_CREATED | ON_PLAYED | INDEPENDENT                 }, // 56
+    { COMMON_JOKER,    4, square_joker_effect,               ON_CREATED | ON_PLAYED | INDEPENDENT                 }, // 57
+    { UNCOMMON_JOKER,  5, smeared_joker_effect,              NO_EVENTS                                            }, // 58
+    { UNCOMMON_JOKER,  4, flash_card_joker_effect,           ON_CREATED | INDEPENDENT                             }, // 59
 
     // The following jokers don't have sprites yet,
     // uncomment them when their sprites are added.
 #if 0
 
-    { COMMON_JOKER,   5, shoot_the_moon_joker_effect,   },
+    { COMMON_JOKER,   5, shoot_the_moon_joker_effect,   ON_HELD },
 #endif
 };
 // clang-format on
 
+#undef NO_EVENTS
+#undef ON_CREATED
+#undef ON_PLAYED
+#undef ON_SCORED
+#undef ON_SCORED_END
+#undef ON_HELD
+#undef INDEPENDENT
+#undef ON_HAND_END
+#undef ON_ROUND_END
+#undef COPYING
+
 static const size_t joker_registry_size = NUM_ELEM_IN_ARR(joker_registry);
 
 #define MODDED_JOKER_START_ID 100
@@ -500,7 +523,7 @@ static u32 joker_effect_noop(
     Joker* joker,
     Card* scored_card,
     enum JokerEvent joker_event,
-    JokerEffect** joker_effect
+    JokerEffect* joker_effect
 )
 {
     return JOKER_EFFECT_FLAG_NONE;
@@ -510,13 +533,12 @@ static u32 default_joker_effect(
     Joker* joker,
     Card* scored_card,
     enum JokerEvent joker_event,
-    JokerEffect** joker_effect
+    JokerEffect* joker_effect
 )
 {
     SCORE_ON_EVENT_ONLY(JOKER_EVENT_INDEPENDENT, joker_event)
-    *joker_effect = &shared_joker_effect;
 
-    (*joker_effect)->mult = 4;
+    joker_effect->mult = 4;
 
     return JOKER_EFFECT_FLAG_MULT;
 }
@@ -525,7 +547,7 @@ static u32 sinful_joker_effect(
     Card* scored_card,
     u8 sinful_suit,
     enum JokerEvent joker_event,
-    JokerEffect** joker_effect
+    JokerEffect* joker_effect
 )
 {
     SCORE_ON_EVENT_ONLY_WITH_CARD(scored_card, JOKER_EVENT_ON_CARD_SCORED, joker_event)
@@ -536,7 +558,7 @@ static u32 sinful_joker_effect(
 
     // ---> START SMEARED JOKER SUIT FIX <---
     // If it's not a perfect match, but we own Smeared Joker (ID 58), check the crossover!
-    if (!is_matching_suit && is_joker_owned(58)) { 
+    if (!is_matching_suit && get_rule_set()->smeared) { 
         if (sinful_suit == HEARTS || sinful_suit == DIAMONDS) {
             if (scored_card->suit == HEARTS || scored_card->suit == DIAMONDS) is_matching_suit = true;
         }
@@ -548,9 +570,7 @@ static u32 sinful_joker_effect(
 
     if (is_matching_suit)
     {
-        *joker_effect = &shared_joker_effect;
-
-        (*joker_effect)->mult = 3;
+        joker_effect->mult = 3;
         effect_flags_ret = JOKER_EFFECT_FLAG_MULT;
     }
     return effect_flags_ret;
@@ -560,7 +580,7 @@ static u32 greedy_joker_effect(
     Joker* joker,
     Card* scored_card,
     enum JokerEvent joker_event,
-    JokerEffect** joker_effect
+    JokerEffect* joker_effect
 )
 {
     return sinful_joker_effect(scored_card, DIAMONDS, joker_event, joker_effect);
@@ -570,7 +590,7 @@ static u32 lusty_joker_effect(
     Joker* joker,
     Card* scored_card,
     enum JokerEvent joker_event,
-    JokerEffect** joker_effect
+    JokerEffect* joker_effect
 )
 {
     return sinful_joker_effect(scored_card, HEARTS, joker_event, joker_effect);
@@ -580,7 +600,7 @@ static u32 wrathful_joker_effect(
     Joker* joker,
     Card* scored_card,
     enum JokerEvent joker_event,
-    JokerEffect** joker_effect
+    JokerEffect* joker_effect
 )
 {
     return sinful_joker_effect(scored_card, SPADES, joker_event, joker_effect);
@@ -590,7 +610,7 @@ static u32 gluttonous_joker_effect(
     Joker* joker,
     Card* scored_card,
     enum JokerEvent joker_event,
-    JokerEffect** joker_effect
+    JokerEffect* joker_effect
 )
 {
     return sinful_joker_effect(scored_card, CLUBS, joker_event, joker_effect);
@@ -600,7 +620,7 @@ static u32 jolly_joker_effect(
     Joker* joker,
     Card* scored_card,
     enum JokerEvent joker_event,
-    JokerEffect** joker_effect
+    JokerEffect* joker_effect
 )
 {
     SCORE_ON_EVENT_ONLY(JOKER_EVENT_INDEPENDENT, joker_event)
@@ -609,9 +629,7 @@ static u32 jolly_joker_effect(
 
     if (get_contained_hands()->PAIR)
     {
-        *joker_effect = &shared_joker_effect;
-
-        (*joker_effect)->mult = 8;
+        joker_effect->mult = 8;
         effect_flags_ret = JOKER_EFFECT_FLAG_MULT;
     }
 
@@ -622,7 +640,7 @@ static u32 zany_joker_effect(
     Joker* joker,
     Card* scored_card,
     enum JokerEvent joker_event,
-    JokerEffect** joker_effect
+    JokerEffect* joker_effect
 )
 {
     SCORE_ON_EVENT_ONLY(JOKER_EVENT_INDEPENDENT, joker_event)
@@ -631,9 +649,7 @@ static u32 zany_joker_effect(
 
     if (get_contained_hands()->THREE_OF_A_KIND)
     {
-        *joker_effect = &shared_joker_effect;
-
-        (*joker_effect)->mult = 12;
+        joker_effect->mult = 12;
         effect_flags_ret = JOKER_EFFECT_FLAG_MULT;
     }
 
@@ -644,7 +660,7 @@ static u32 mad_joker_effect(
     Joker* joker,
     Card* scored_card,
     enum JokerEvent joker_event,
-    JokerEffect** joker_effect
+    JokerEffect* joker_effect
 )
 {
     SCORE_ON_EVENT_ONLY(JOKER_EVENT_INDEPENDENT, joker_event)
@@ -653,9 +669,7 @@ static u32 mad_joker_effect(
 
     if (get_contained_hands()->TWO_PAIR)
     {
-        *joker_effect = &shared_joker_effect;
-
-        (*joker_effect)->mult = 10;
+        joker_effect->mult = 10;
         effect_flags_ret = JOKER_EFFECT_FLAG_MULT;
     }
 
@@ -666,7 +680,7 @@ static u32 crazy_joker_effect(
     Joker* joker,
     Card* scored_card,
     enum JokerEvent joker_event,
-    JokerEffect** joker_effect
+    JokerEffect* joker_effect
 )
 {
     SCORE_ON_EVENT_ONLY(JOKER_EVENT_INDEPENDENT, joker_event)
@@ -675,9 +689,7 @@ static u32 crazy_joker_effect(
 
     if (get_contained_hands()->STRAIGHT)
     {
-        *joker_effect = &shared_joker_effect;
-
-        (*joker_effect)->mult = 12;
+        joker_effect->mult = 12;
         effect_flags_ret = JOKER_EFFECT_FLAG_MULT;
     }
 
@@ -688,7 +700,7 @@ static u32 droll_joker_effect(
     Joker* joker,
     Card* scored_card,
     enum JokerEvent joker_event,
-    JokerEffect** joker_effect
+    JokerEffect* joker_effect
 )
 {
     SCORE_ON_EVENT_ONLY(JOKER_EVENT_INDEPENDENT, joker_event)
@@ -697,9 +709,7 @@ static u32 droll_joker_effect(
 
     if (get_contained_hands()->FLUSH)
     {
-        *joker_effect = &shared_joker_effect;
-
-        (*joker_effect)->mult = 10;
+        joker_effect->mult = 10;
         effect_flags_ret = JOKER_EFFECT_FLAG_MULT;
     }
 
@@ -710,7 +720,7 @@ static u32 sly_joker_effect(
     Joker* joker,
     Card* scored_card,
     enum JokerEvent joker_event,
-    JokerEffect** joker_effect
+    JokerEffect* joker_effect
 )
 {
     SCORE_ON_EVENT_ONLY(JOKER_EVENT_INDEPENDENT, joker_event)
@@ -719,9 +729,7 @@ static u32 sly_joker_effect(
 
     if (get_contained_hands()->PAIR)
     {
-        *joker_effect = &shared_joker_effect;
-
-        (*joker_effect)->chips = 50;
+        joker_effect->chips = 50;
         effect_flags_ret = JOKER_EFFECT_FLAG_CHIPS;
     }
 
@@ -732,7 +740,7 @@ static u32 wily_joker_effect(
     Joker* joker,
     Card* scored_card,
     enum JokerEvent joker_event,
-    JokerEffect** joker_effect
+    JokerEffect* joker_effect
 )
 {
     SCORE_ON_EVENT_ONLY(JOKER_EVENT_INDEPENDENT, joker_event)
@@ -741,9 +749,7 @@ static u32 wily_joker_effect(
 
     if (get_contained_hands()->THREE_OF_A_KIND)
     {
-        *joker_effect = &shared_joker_effect;
-
-        (*joker_effect)->chips = 100;
+        joker_effect->chips = 100;
         effect_flags_ret = JOKER_EFFECT_FLAG_CHIPS;
     }
 
@@ -754,7 +760,7 @@ static u32 clever_joker_effect(
     Joker* joker,
     Card* scored_card,
     enum JokerEvent joker_event,
-    JokerEffect** joker_effect
+    JokerEffect* joker_effect
 )
 {
     SCORE_ON_EVENT_ONLY(JOKER_EVENT_INDEPENDENT, joker_event)
@@ -763,9 +769,7 @@ static u32 clever_joker_effect(
 
     if (get_contained_hands()->TWO_PAIR)
     {
-        *joker_effect = &shared_joker_effect;
-
-        (*joker_effect)->chips = 80;
+        joker_effect->chips = 80;
         effect_flags_ret = JOKER_EFFECT_FLAG_CHIPS;
     }
 
@@ -776,7 +780,7 @@ static u32 devious_joker_effect(
     Joker* joker,
     Card* scored_card,
     enum JokerEvent joker_event,
-    JokerEffect** joker_effect
+    JokerEffect* joker_effect
 )
 {
     SCORE_ON_EVENT_ONLY(JOKER_EVENT_INDEPENDENT, joker_event)
@@ -785,9 +789,7 @@ static u32 devious_joker_effect(
 
     if (get_contained_hands()->STRAIGHT)
     {
-        *joker_effect = &shared_joker_effect;
-
-        (*joker_effect)->chips = 100;
+        joker_effect->chips = 100;
         effect_flags_ret = JOKER_EFFECT_FLAG_CHIPS;
     }
 
@@ -798,7 +800,7 @@ static u32 crafty_joker_effect(
     Joker* joker,
     Card* scored_card,
     enum JokerEvent joker_event,
-    JokerEffect** joker_effect
+    JokerEffect* joker_effect
 )
 {
     SCORE_ON_EVENT_ONLY(JOKER_EVENT_INDEPENDENT, joker_event)
@@ -807,9 +809,7 @@ static u32 crafty_joker_effect(
 
     if (get_contained_hands()->FLUSH)
     {
-        *joker_effect = &shared_joker_effect;
-
-        (*joker_effect)->chips = 80;
+        joker_effect->chips = 80;
         effect_flags_ret = JOKER_EFFECT_FLAG_CHIPS;
     }
 
@@ -820,7 +820,7 @@ static u32 half_joker_effect(
     Joker* joker,
     Card* scored_card,
     enum JokerEvent joker_event,
-    JokerEffect** joker_effect
+    JokerEffect* joker_effect
 )
 {
     SCORE_ON_EVENT_ONLY(JOKER_EVENT_INDEPENDENT, joker_event)
@@ -830,9 +830,7 @@ static u32 half_joker_effect(
     int played_size = get_played_top() + 1;
     if (played_size <= 3)
     {
-        *joker_effect = &shared_joker_effect;
-
-        (*joker_effect)->mult = 20;
+        joker_effect->mult = 20;
         effect_flags_ret = JOKER_EFFECT_FLAG_MULT;
     }
 
@@ -843,19 +841,18 @@ static u32 joker_stencil_effect(
     Joker* joker,
     Card* scored_card,
     enum JokerEvent joker_event,
-    JokerEffect** joker_effect
+    JokerEffect* joker_effect
 )
 {
     SCORE_ON_EVENT_ONLY(JOKER_EVENT_INDEPENDENT, joker_event)
 
-    *joker_effect = &shared_joker_effect;
 
     List* jokers = get_jokers_list();
 
     // +1 xmult per empty joker slot...
     int num_jokers = list_get_len(jokers);
 
-    (*joker_effect)->xmult = (MAX_JOKERS_HELD_SIZE)-num_jokers;
+    joker_effect->xmult = (MAX_JOKERS_HELD_SIZE)-num_jokers;
 
     // ...and also each stencil_joker adds +1 xmult
     ListItr itr = list_itr_create(jokers);
@@ -864,7 +861,7 @@ static u32 joker_stencil_effect(
     while ((joker_object = list_itr_next(&itr)))
     {
         if (joker_object->joker->id == STENCIL_JOKER_ID)
-            (*joker_effect)->xmult++;
+            joker_effect->xmult++;
     }
 
     return JOKER_EFFECT_FLAG_XMULT;
@@ -875,14 +872,15 @@ static u32 misprint_joker_effect(
     Joker* joker,
     Card* scored_card,
     enum JokerEvent joker_event,
-    JokerEffect** joker_effect
+    JokerEffect* joker_effect
 )
 {
     SCORE_ON_EVENT_ONLY(JOKER_EVENT_INDEPENDENT, joker_event)
 
-    *joker_effect = &shared_joker_effect;
 
-    (*joker_effect)->mult = random() % (MISPRINT_MAX_MULT + 1);
+    // Previews use the average roll and leave the game's random sequence alone
+    joker_effect->mult =
+        game_is_score_preview() ? MISPRINT_MAX_MULT / 2 : random() % (MISPRINT_MAX_MULT + 1);
 
     return JOKER_EFFECT_FLAG_MULT;
 }
@@ -891,7 +889,7 @@ static u32 walkie_talkie_joker_effect(
     Joker* joker,
     Card* scored_card,
     enum JokerEvent joker_event,
-    JokerEffect** joker_effect
+    JokerEffect* joker_effect
 )
 {
     SCORE_ON_EVENT_ONLY_WITH_CARD(scored_card, JOKER_EVENT_ON_CARD_SCORED, joker_event)
@@ -900,10 +898,8 @@ static u32 walkie_talkie_joker_effect(
 
     if (scored_card->rank == TEN || scored_card->rank == FOUR)
     {
-        *joker_effect = &shared_joker_effect;
-
-        (*joker_effect)->chips = 10;
-        (*joker_effect)->mult = 4;
+        joker_effect->chips = 10;
+        joker_effect->mult = 4;
         effect_flags_ret = JOKER_EFFECT_FLAG_CHIPS | JOKER_EFFECT_FLAG_MULT;
     }
 
@@ -914,7 +910,7 @@ static u32 fibonnaci_joker_effect(
     Joker* joker,
     Card* scored_card,
     enum JokerEvent joker_event,
-    JokerEffect** joker_effect
+    JokerEffect* joker_effect
 )
 {
     SCORE_ON_EVENT_ONLY_WITH_CARD(scored_card, JOKER_EVENT_ON_CARD_SCORED, joker_event)
@@ -928,8 +924,7 @@ static u32 fibonnaci_joker_effect(
         case THREE:
         case FIVE:
         case EIGHT:
-            *joker_effect = &shared_joker_effect;
-            (*joker_effect)->mult = 8;
+            joker_effect->mult = 8;
             effect_flags_ret = JOKER_EFFECT_FLAG_MULT;
             break;
         default:
@@ -943,7 +938,7 @@ static u32 banner_joker_effect(
     Joker* joker,
     Card* scored_card,
     enum JokerEvent joker_event,
-    JokerEffect** joker_effect
+    JokerEffect* joker_effect
 )
 {
     SCORE_ON_EVENT_ONLY(JOKER_EVENT_INDEPENDENT, joker_event)
@@ -952,9 +947,7 @@ static u32 banner_joker_effect(
 
     if (get_num_discards_remaining() > 0)
     {
-        *joker_effect = &shared_joker_effect;
-
-        (*joker_effect)->chips = 30 * get_num_discards_remaining();
+        joker_effect->chips = 30 * get_num_discards_remaining();
         effect_flags_ret = JOKER_EFFECT_FLAG_CHIPS;
     }
 
@@ -965,7 +958,7 @@ static u32 mystic_summit_joker_effect(
     Joker* joker,
     Card* scored_card,
     enum JokerEvent joker_event,
-    JokerEffect** joker_effect
+    JokerEffect* joker_effect
 )
 {
     SCORE_ON_EVENT_ONLY(JOKER_EVENT_INDEPENDENT, joker_event)
@@ -974,9 +967,7 @@ static u32 mystic_summit_joker_effect(
 
     if (get_num_discards_remaining() == 0)
     {
-        *joker_effect = &shared_joker_effect;
-
-        (*joker_effect)->mult = 15;
+        joker_effect->mult = 15;
         effect_flags_ret = JOKER_EFFECT_FLAG_MULT;
     }
 
@@ -987,7 +978,7 @@ static u32 blackboard_joker_effect(
     Joker* joker,
     Card* scored_card,
     enum JokerEvent joker_event,
-    JokerEffect** joker_effect
+    JokerEffect* joker_effect
 )
 {
     SCORE_ON_EVENT_ONLY(JOKER_EVENT_INDEPENDENT, joker_event)
@@ -1009,9 +1000,7 @@ static u32 blackboard_joker_effect(
 
     if (all_cards_are_spades_or_clubs)
     {
-        *joker_effect = &shared_joker_effect;
-
-        (*joker_effect)->xmult = 3;
+        joker_effect->xmult = 3;
         effect_flags_ret = JOKER_EFFECT_FLAG_XMULT;
     }
 
@@ -1022,14 +1011,13 @@ static u32 blue_joker_effect(
     Joker* joker,
     Card* scored_card,
     enum JokerEvent joker_event,
-    JokerEffect** joker_effect
+    JokerEffect* joker_effect
 )
 {
     SCORE_ON_EVENT_ONLY(JOKER_EVENT_INDEPENDENT, joker_event)
 
-    *joker_effect = &shared_joker_effect;
 
-    (*joker_effect)->chips = (get_deck_top() + 1) * 2;
+    joker_effect->chips = (get_deck_top() + 1) * 2;
 
     return JOKER_EFFECT_FLAG_CHIPS;
 }
@@ -1038,7 +1026,7 @@ static u32 raised_fist_joker_effect(
     Joker* joker,
     Card* scored_card,
     enum JokerEvent joker_event,
-    JokerEffect** joker_effect
+    JokerEffect* joker_effect
 )
 {
     s32* p_lowest_value_index = &(joker->scoring_state);
@@ -1070,9 +1058,7 @@ static u32 raised_fist_joker_effect(
         case JOKER_EVENT_ON_CARD_HELD:
             if (get_scored_card_index() == *p_lowest_value_index)
             {
-                *joker_effect = &shared_joker_effect;
-
-                (*joker_effect)->mult = 2 * card_get_value(scored_card);
+                joker_effect->mult = 2 * card_get_value(scored_card);
                 effect_flags_ret = JOKER_EFFECT_FLAG_MULT;
             }
             break;
@@ -1088,18 +1074,17 @@ static u32 reserved_parking_joker_effect(
     Joker* joker,
     Card* scored_card,
     enum JokerEvent joker_event,
-    JokerEffect** joker_effect
+    JokerEffect* joker_effect
 )
 {
     SCORE_ON_EVENT_ONLY(JOKER_EVENT_ON_CARD_HELD, joker_event)
 
     u32 effect_flags_ret = JOKER_EFFECT_FLAG_NONE;
 
-    if ((random() % 2 == 0) && card_is_face(scored_card))
+    // Money never changes a score, previews skip the roll to leave the random sequence alone
+    if (!game_is_score_preview() && (random() % 2 == 0) && card_is_face(scored_card))
     {
-        *joker_effect = &shared_joker_effect;
-
-        (*joker_effect)->money = 1;
+        joker_effect->money = 1;
         effect_flags_ret = JOKER_EFFECT_FLAG_MONEY;
     }
 
@@ -1110,18 +1095,17 @@ static u32 business_card_joker_effect(
     Joker* joker,
     Card* scored_card,
     enum JokerEvent joker_event,
-    JokerEffect** joker_effect
+    JokerEffect* joker_effect
 )
 {
     SCORE_ON_EVENT_ONLY_WITH_CARD(scored_card, JOKER_EVENT_ON_CARD_SCORED, joker_event)
 
     u32 effect_flags_ret = JOKER_EFFECT_FLAG_NONE;
 
-    if ((random() % 2 == 0) && card_is_face(scored_card))
+    // Money never changes a score, previews skip the roll to leave the random sequence alone
+    if (!game_is_score_preview() && (random() % 2 == 0) && card_is_face(scored_card))
     {
-        *joker_effect = &shared_joker_effect;
-
-        (*joker_effect)->money = 2;
+        joker_effect->money = 2;
         effect_flags_ret = JOKER_EFFECT_FLAG_MONEY;
     }
 
@@ -1132,7 +1116,7 @@ static u32 scholar_joker_effect(
     Joker* joker,
     Card* scored_card,
     enum JokerEvent joker_event,
-    JokerEffect** joker_effect
+    JokerEffect* joker_effect
 )
 {
     SCORE_ON_EVENT_ONLY_WITH_CARD(scored_card, JOKER_EVENT_ON_CARD_SCORED, joker_event)
@@ -1141,10 +1125,8 @@ static u32 scholar_joker_effect(
 
     if (scored_card->rank == ACE)
     {
-        *joker_effect = &shared_joker_effect;
-
-        (*joker_effect)->chips = 20;
-        (*joker_effect)->mult = 4;
+        joker_effect->chips = 20;
+        joker_effect->mult = 4;
         effect_flags_ret = JOKER_EFFECT_FLAG_CHIPS | JOKER_EFFECT_FLAG_MULT;
     }
 
@@ -1155,7 +1137,7 @@ static u32 scary_face_joker_effect(
     Joker* joker,
     Card* scored_card,
     enum JokerEvent joker_event,
-    JokerEffect** joker_effect
+    JokerEffect* joker_effect
 )
 {
     SCORE_ON_EVENT_ONLY_WITH_CARD(scored_card, JOKER_EVENT_ON_CARD_SCORED, joker_event)
@@ -1164,9 +1146,7 @@ static u32 scary_face_joker_effect(
 
     if (card_is_face(scored_card))
     {
-        *joker_effect = &shared_joker_effect;
-
-        (*joker_effect)->chips = 30;
+        joker_effect->chips = 30;
         effect_flags_ret = JOKER_EFFECT_FLAG_CHIPS;
     }
 
@@ -1177,17 +1157,16 @@ static u32 abstract_joker_effect(
     Joker* joker,
     Card* scored_card,
     enum JokerEvent joker_event,
-    JokerEffect** joker_effect
+    JokerEffect* joker_effect
 )
 {
     SCORE_ON_EVENT_ONLY(JOKER_EVENT_INDEPENDENT, joker_event)
 
-    *joker_effect = &shared_joker_effect;
 
     // +1 xmult per occupied joker slot
     int num_jokers = list_get_len(get_jokers_list());
 
-    (*joker_effect)->mult = num_jokers * 3;
+    joker_effect->mult = num_jokers * 3;
 
     return JOKER_EFFECT_FLAG_MULT;
 }
@@ -1196,7 +1175,7 @@ static u32 bull_joker_effect(
     Joker* joker,
     Card* scored_card,
     enum JokerEvent joker_event,
-    JokerEffect** joker_effect
+    JokerEffect* joker_effect
 )
 {
     SCORE_ON_EVENT_ONLY(JOKER_EVENT_INDEPENDENT, joker_event)
@@ -1207,9 +1186,7 @@ static u32 bull_joker_effect(
     // This allows us to avoid scoring negative Chips
     if (get_money() > 0)
     {
-        *joker_effect = &shared_joker_effect;
-
-        (*joker_effect)->chips = get_money() * 2;
+        joker_effect->chips = get_money() * 2;
         effect_flags_ret = JOKER_EFFECT_FLAG_CHIPS;
     }
 
@@ -1220,7 +1197,7 @@ static u32 smiley_face_joker_effect(
     Joker* joker,
     Card* scored_card,
     enum JokerEvent joker_event,
-    JokerEffect** joker_effect
+    JokerEffect* joker_effect
 )
 {
     SCORE_ON_EVENT_ONLY_WITH_CARD(scored_card, JOKER_EVENT_ON_CARD_SCORED, joker_event)
@@ -1229,9 +1206,7 @@ static u32 smiley_face_joker_effect(
 
     if (card_is_face(scored_card))
     {
-        *joker_effect = &shared_joker_effect;
-
-        (*joker_effect)->mult = 5;
+        joker_effect->mult = 5;
         effect_flags_ret = JOKER_EFFECT_FLAG_MULT;
     }
 
@@ -1242,7 +1217,7 @@ static u32 even_steven_joker_effect(
     Joker* joker,
     Card* scored_card,
     enum JokerEvent joker_event,
-    JokerEffect** joker_effect
+    JokerEffect* joker_effect
 )
 {
     SCORE_ON_EVENT_ONLY_WITH_CARD(scored_card, JOKER_EVENT_ON_CARD_SCORED, joker_event)
@@ -1258,9 +1233,7 @@ static u32 even_steven_joker_effect(
         default:
             if (card_get_value(scored_card) % 2 == 0)
             {
-                *joker_effect = &shared_joker_effect;
-
-                (*joker_effect)->mult = 4;
+                joker_effect->mult = 4;
                 effect_flags_ret = JOKER_EFFECT_FLAG_MULT;
             }
             break;
@@ -1273,7 +1246,7 @@ static u32 odd_todd_joker_effect(
     Joker* joker,
     Card* scored_card,
     enum JokerEvent joker_event,
-    JokerEffect** joker_effect
+    JokerEffect* joker_effect
 )
 {
     SCORE_ON_EVENT_ONLY_WITH_CARD(scored_card, JOKER_EVENT_ON_CARD_SCORED, joker_event)
@@ -1282,9 +1255,7 @@ static u32 odd_todd_joker_effect(
 
     if (card_get_value(scored_card) % 2 == 1) // todo test ace
     {
-        *joker_effect = &shared_joker_effect;
-
-        (*joker_effect)->chips = 31;
+        joker_effect->chips = 31;
         effect_flags_ret = JOKER_EFFECT_FLAG_CHIPS;
     }
 
@@ -1295,7 +1266,7 @@ static u32 acrobat_joker_effect(
     Joker* joker,
     Card* scored_card,
     enum JokerEvent joker_event,
-    JokerEffect** joker_effect
+    JokerEffect* joker_effect
 )
 {
     SCORE_ON_EVENT_ONLY(JOKER_EVENT_INDEPENDENT, joker_event)
@@ -1305,9 +1276,7 @@ static u32 acrobat_joker_effect(
     // 0 remaining hands mean we're scoring the last hand
     if (get_num_hands_remaining() == 0)
     {
-        *joker_effect = &shared_joker_effect;
-
-        (*joker_effect)->xmult = 3;
+        joker_effect->xmult = 3;
         effect_flags_ret = JOKER_EFFECT_FLAG_XMULT;
     }
 
@@ -1318,7 +1287,7 @@ static u32 hanging_chad_joker_effect(
     Joker* joker,
     Card* scored_card,
     enum JokerEvent joker_event,
-    JokerEffect** joker_effect
+    JokerEffect* joker_effect
 )
 {
     u32 effect_flags_ret = JOKER_EFFECT_FLAG_NONE;
@@ -1334,13 +1303,11 @@ static u32 hanging_chad_joker_effect(
         // p_remaining_retriggers will always reach 0 on the first card, then retrigger
         // will be false and scoring will go onto the next card
         case JOKER_EVENT_ON_CARD_SCORED_END:
-            *joker_effect = &shared_joker_effect;
-
-            (*joker_effect)->retrigger = (*p_remaining_retriggers > 0);
-            if ((*joker_effect)->retrigger)
+            joker_effect->retrigger = (*p_remaining_retriggers > 0);
+            if (joker_effect->retrigger)
             {
                 *p_remaining_retriggers -= 1;
-                (*joker_effect)->message = "Again!";
+                joker_effect->message = "Again!";
                 effect_flags_ret = JOKER_EFFECT_FLAG_RETRIGGER | JOKER_EFFECT_FLAG_MESSAGE;
             }
             break;
@@ -1356,7 +1323,7 @@ static u32 the_duo_joker_effect(
     Joker* joker,
     Card* scored_card,
     enum JokerEvent joker_event,
-    JokerEffect** joker_effect
+    JokerEffect* joker_effect
 )
 {
     SCORE_ON_EVENT_ONLY(JOKER_EVENT_INDEPENDENT, joker_event)
@@ -1365,9 +1332,7 @@ static u32 the_duo_joker_effect(
 
     if (get_contained_hands()->PAIR)
     {
-        *joker_effect = &shared_joker_effect;
-
-        (*joker_effect)->xmult = 2;
+        joker_effect->xmult = 2;
         effect_flags_ret = JOKER_EFFECT_FLAG_XMULT;
     }
 
@@ -1378,7 +1343,7 @@ static u32 the_trio_joker_effect(
     Joker* joker,
     Card* scored_card,
     enum JokerEvent joker_event,
-    JokerEffect** joker_effect
+    JokerEffect* joker_effect
 )
 {
     SCORE_ON_EVENT_ONLY(JOKER_EVENT_INDEPENDENT, joker_event)
@@ -1387,9 +1352,7 @@ static u32 the_trio_joker_effect(
 
     if (get_contained_hands()->THREE_OF_A_KIND)
     {
-        *joker_effect = &shared_joker_effect;
-
-        (*joker_effect)->xmult = 3;
+        joker_effect->xmult = 3;
         effect_flags_ret = JOKER_EFFECT_FLAG_XMULT;
     }
 
@@ -1400,7 +1363,7 @@ static u32 the_family_joker_effect(
     Joker* joker,
     Card* scored_card,
     enum JokerEvent joker_event,
-    JokerEffect** joker_effect
+    JokerEffect* joker_effect
 )
 {
     SCORE_ON_EVENT_ONLY(JOKER_EVENT_INDEPENDENT, joker_event)
@@ -1409,9 +1372,7 @@ static u32 the_family_joker_effect(
 
     if (get_contained_hands()->FOUR_OF_A_KIND)
     {
-        *joker_effect = &shared_joker_effect;
-
-        (*joker_effect)->xmult = 4;
+        joker_effect->xmult = 4;
         effect_flags_ret = JOKER_EFFECT_FLAG_XMULT;
     }
 
@@ -1422,7 +1383,7 @@ static u32 the_order_joker_effect(
     Joker* joker,
     Card* scored_card,
     enum JokerEvent joker_event,
-    JokerEffect** joker_effect
+    JokerEffect* joker_effect
 )
 {
     SCORE_ON_EVENT_ONLY(JOKER_EVENT_INDEPENDENT, joker_event)
@@ -1431,9 +1392,7 @@ static u32 the_order_joker_effect(
 
     if (get_contained_hands()->STRAIGHT)
     {
-        *joker_effect = &shared_joker_effect;
-
-        (*joker_effect)->xmult = 3;
+        joker_effect->xmult = 3;
         effect_flags_ret = JOKER_EFFECT_FLAG_XMULT;
     }
 
@@ -1444,7 +1403,7 @@ static u32 the_tribe_joker_effect(
     Joker* joker,
     Card* scored_card,
     enum JokerEvent joker_event,
-    JokerEffect** joker_effect
+    JokerEffect* joker_effect
 )
 {
     SCORE_ON_EVENT_ONLY(JOKER_EVENT_INDEPENDENT, joker_event)
@@ -1453,9 +1412,7 @@ static u32 the_tribe_joker_effect(
 
     if (get_contained_hands()->FLUSH)
     {
-        *joker_effect = &shared_joker_effect;
-
-        (*joker_effect)->xmult = 2;
+        joker_effect->xmult = 2;
         effect_flags_ret = JOKER_EFFECT_FLAG_XMULT;
     }
 
@@ -1466,7 +1423,7 @@ static u32 bootstraps_joker_effect(
     Joker* joker,
     Card* scored_card,
     enum JokerEvent joker_event,
-    JokerEffect** joker_effect
+    JokerEffect* joker_effect
 )
 {
     SCORE_ON_EVENT_ONLY(JOKER_EVENT_INDEPENDENT, joker_event)
@@ -1476,9 +1433,7 @@ static u32 bootstraps_joker_effect(
     // Same protection as the Bull Joker
     if (get_money() > 0)
     {
-        *joker_effect = &shared_joker_effect;
-
-        (*joker_effect)->mult = (get_money() / 5) * 2;
+        joker_effect->mult = (get_money() / 5) * 2;
         effect_flags_ret = JOKER_EFFECT_FLAG_MULT;
     }
 
@@ -1493,7 +1448,7 @@ static u32 shoot_the_moon_joker_effect(
     Joker* joker,
     Card* scored_card,
     enum JokerEvent joker_event,
-    JokerEffect** joker_effect
+    JokerEffect* joker_effect
 )
 {
     SCORE_ON_EVENT_ONLY(JOKER_EVENT_ON_CARD_HELD, joker_event)
@@ -1502,9 +1457,7 @@ static u32 shoot_the_moon_joker_effect(
 
     if (scored_card->rank == QUEEN)
     {
-        *joker_effect = &shared_joker_effect;
-
-        (*joker_effect)->mult = 13;
+        joker_effect->mult = 13;
         effect_flags_ret = JOKER_EFFECT_FLAG_MULT;
     }
 
@@ -1516,7 +1469,7 @@ static u32 photograph_joker_effect(
     Joker* joker,
     Card* scored_card,
     enum JokerEvent joker_event,
-    JokerEffect** joker_effect
+    JokerEffect* joker_effect
 )
 {
     u32 effect_flags_ret = JOKER_EFFECT_FLAG_NONE;
@@ -1541,9 +1494,7 @@ static u32 photograph_joker_effect(
             // and we will catch potential retriggers
             if (*p_first_face_index == get_scored_card_index())
             {
-                *joker_effect = &shared_joker_effect;
-
-                (*joker_effect)->xmult = 2;
+                joker_effect->xmult = 2;
                 effect_flags_ret = JOKER_EFFECT_FLAG_XMULT;
             }
             break;
@@ -1558,7 +1509,7 @@ static u32 dusk_joker_effect(
     Joker* joker,
     Card* scored_card,
     enum JokerEvent joker_event,
-    JokerEffect** joker_effect
+    JokerEffect* joker_effect
 )
 {
     u32 effect_flags_ret = JOKER_EFFECT_FLAG_NONE;
@@ -1576,13 +1527,11 @@ static u32 dusk_joker_effect(
             // Only retrigger current card if it's strictly after the last one we retriggered
             if (get_num_hands_remaining() == 0)
             {
-                *joker_effect = &shared_joker_effect;
-
-                (*joker_effect)->retrigger = (*p_last_retriggered_index < get_scored_card_index());
-                if ((*joker_effect)->retrigger)
+                joker_effect->retrigger = (*p_last_retriggered_index < get_scored_card_index());
+                if (joker_effect->retrigger)
                 {
                     *p_last_retriggered_index = get_scored_card_index();
-                    (*joker_effect)->message = "Again!";
+                    joker_effect->message = "Again!";
                     effect_flags_ret = JOKER_EFFECT_FLAG_RETRIGGER | JOKER_EFFECT_FLAG_MESSAGE;
                 }
             }
@@ -1596,11 +1545,70 @@ static u32 dusk_joker_effect(
     return effect_flags_ret;
 }
 
+void joker_build_rule_set(RuleSet* rules)
+{
+    rules->straight_size = is_joker_owned(FOUR_FINGERS_JOKER_ID)
+                               ? STRAIGHT_AND_FLUSH_SIZE_FOUR_FINGERS
+                               : STRAIGHT_AND_FLUSH_SIZE_DEFAULT;
+    rules->shortcut = is_joker_owned(SHORTCUT_JOKER_ID);
+    rules->smeared = is_joker_owned(SMEARED_JOKER_ID);
+    rules->mobius_wrap = is_joker_owned(MOBIUS_JOKER_ID);
+    rules->legacy_wrap = is_joker_owned(LEGACY_WRAP_JOKER_ID);
+    rules->pareidolia = is_joker_owned(PAREIDOLIA_JOKER_ID);
+    rules->face_rank_mask = rules->pareidolia ? ALL_RANKS_MASK : FACE_RANK_MASK;
+}
+
+void joker_resolve_copy_targets(List* joker_objects)
+{
+    JokerObject* jokers[MAX_ACTIVE_JOKERS];
+    int num_jokers = 0;
+
+    ListItr itr = list_itr_create(joker_objects);
+    JokerObject* joker_object;
+    while ((joker_object = list_itr_next(&itr)) && num_jokers < MAX_ACTIVE_JOKERS)
+    {
+        jokers[num_jokers++] = joker_object;
+    }
+
+    for (int i = 0; i < num_jokers; i++)
+    {
+        // find the copied Joker, may need to bounce around Blueprints and a Brainstorm
+        // If we go past the end, we have a Blueprint at the end of the list that can't copy
+        // anything. If we go through a Brainstorm twice, we are in a loop and need to exit
+        Joker* copied_joker = NULL;
+        int copied_idx = i;
+        u8 brainstorm_counter = 0;
+        while (copied_idx < num_jokers && brainstorm_counter < 2)
+        {
+            u8 copied_joker_id = jokers[copied_idx]->joker->id;
+            if (copied_joker_id == BLUEPRINT_JOKER_ID)
+            {
+                // get the next Joker for Blueprint
+                copied_idx++;
+            }
+            else if (copied_joker_id == BRAINSTORM_JOKER_ID)
+            {
+                // Get the first (leftmost) Joker for Brainstorm
+                brainstorm_counter++;
+                copied_idx = 0;
+            }
+            else
+            {
+                copied_joker = jokers[copied_idx]->joker;
+                break;
+            }
+        }
+
+        // Only copying Jokers keep a target, the chain above ends on the Joker itself otherwise
+        jokers[i]->joker->copied_joker = copied_joker != jokers[i]->joker ? copied_joker : NULL;
+    }
+}
+
 static u32 blueprint_brainstorm_joker_effect(
     Joker* joker,
     Card* scored_card,
     enum JokerEvent joker_event,
-    JokerEffect** joker_effect
+    JokerEffect* joker_effect
 )
 {
     u32 effect_flags_ret = JOKER_EFFECT_FLAG_NONE;
@@ -1613,70 +1621,32 @@ static u32 blueprint_brainstorm_joker_effect(
         return effect_flags_ret;
     }
 
-    // find ourselves in the Jokers list
-    List* jokers = get_jokers_list();
-    ListItr itr = list_itr_create(jokers);
-    JokerObject* copied_joker_object;
-    while ((copied_joker_object = list_itr_next(&itr)))
+    // The copy chain was resolved when the Jokers list last changed,
+    // NULL means there is nothing to copy
+    Joker* copied_joker = joker->copied_joker;
+    if (copied_joker == NULL)
     {
-        if (copied_joker_object->joker == joker)
-        {
-            break;
-        }
+        return effect_flags_ret;
     }
 
-    // This shouldn't happen since if we are a scoring Joker, we should always
-    // be part of the Jokers list, but being extra careful doesn't cost much
-    if (copied_joker_object == NULL)
+    // how we copy depends on the copied Joker's ID because they don't
+    // all handle data the same way.
+    const JokerInfo* copied_joker_info = get_joker_registry_entry(copied_joker->id);
+    if (copied_joker_info == NULL)
     {
         return effect_flags_ret;
     }
 
-    // find the copied Joker, may need to bounce around Blueprints and a Brainstorm
-    // If we encounter NULL, we have a Blueprint at the end of the list that can't copy anything.
-    // If we go through a Brainstorms twice, we will be in a loop and need to exit
-    u8 brainstorm_counter = 0;
-    do
-    {
-        switch (copied_joker_object->joker->id)
-        {
-            // get the next Joker for Blueprint
-            case BLUEPRINT_JOKER_ID:
-                copied_joker_object = list_itr_next(&itr);
-                break;
-
-            // Get the first (leftmost) Joker for Brainstorm
-            case BRAINSTORM_JOKER_ID:
-                brainstorm_counter++;
-                itr = list_itr_create(jokers);
-                copied_joker_object = list_itr_next(&itr);
-                break;
-
-            // We encountered a Joker that isn't a Copying Joker and copy it now
-            // but how we copy it depends on this Joker's ID because they don't
-            // all handle data the same way.
-            default:
-                u8 copied_joker_id = copied_joker_object->joker->id;
-                const JokerInfo* copied_joker_info = get_joker_registry_entry(copied_joker_id);
-
-                // Copy the persistent data
-                joker->persistent_state = copied_joker_object->joker->persistent_state;
+    // Copy the persistent data
+    joker->persistent_state = copied_joker->persistent_state;
 
-                // Then regardless of if we copied the data above, apply the
-                // copied JokerEffect function to the local data
-                effect_flags_ret =
-                    copied_joker_info
-                        ->joker_effect_func(joker, scored_card, joker_event, joker_effect);
+    // Then regardless of if we copied the data above, apply the
+    // copied JokerEffect function to the local data
+    effect_flags_ret =
+        copied_joker_info->joker_effect_func(joker, scored_card, joker_event, joker_effect);
 
-                // make also sure we don't expire
-                effect_flags_ret &= ~JOKER_EFFECT_FLAG_EXPIRE;
-
-                // exit the loop
-                copied_joker_object = NULL;
-
-                break;
-        }
-    } while (copied_joker_object != NULL && brainstorm_counter < 2);
+    // make also sure we don't expire
+    effect_flags_ret &= ~JOKER_EFFECT_FLAG_EXPIRE;
 
     return effect_flags_ret;
 }
@@ -1685,7 +1655,7 @@ static u32 hack_joker_effect(
     Joker* joker,
     Card* scored_card,
     enum JokerEvent joker_event,
-    JokerEffect** joker_effect
+    JokerEffect* joker_effect
 )
 {
     u32 effect_flags_ret = JOKER_EFFECT_FLAG_NONE;
@@ -1706,14 +1676,12 @@ static u32 hack_joker_effect(
                 case THREE:
                 case FOUR:
                 case FIVE:
-                    *joker_effect = &shared_joker_effect;
-
-                    (*joker_effect)->retrigger =
+                    joker_effect->retrigger =
                         (*p_last_retriggered_index < get_scored_card_index());
-                    if ((*joker_effect)->retrigger)
+                    if (joker_effect->retrigger)
                     {
                         *p_last_retriggered_index = get_scored_card_index();
-                        (*joker_effect)->message = "Again!";
+                        joker_effect->message = "Again!";
                         effect_flags_ret = JOKER_EFFECT_FLAG_RETRIGGER | JOKER_EFFECT_FLAG_MESSAGE;
                     }
                     break;
@@ -1731,7 +1699,7 @@ static u32 seltzer_joker_effect(
     Joker* joker,
     Card* scored_card,
     enum JokerEvent joker_event,
-    JokerEffect** joker_effect
+    JokerEffect* joker_effect
 )
 {
     u32 effect_flags_ret = JOKER_EFFECT_FLAG_NONE;
@@ -1753,19 +1721,17 @@ static u32 seltzer_joker_effect(
             // Works the same way as Dusk
             // No need to check for p_hands_left_until_exp because the Joker
             // will be destroyed the moment we hit 0
-            *joker_effect = &shared_joker_effect;
 
-            (*joker_effect)->retrigger = ((*p_last_retriggered_idx) < get_scored_card_index());
-            if ((*joker_effect)->retrigger)
+            joker_effect->retrigger = ((*p_last_retriggered_idx) < get_scored_card_index());
+            if (joker_effect->retrigger)
             {
                 *p_last_retriggered_idx = get_scored_card_index();
-                (*joker_effect)->message = "Again!";
+                joker_effect->message = "Again!";
                 effect_flags_ret = JOKER_EFFECT_FLAG_RETRIGGER | JOKER_EFFECT_FLAG_MESSAGE;
             }
             break;
 
         case JOKER_EVENT_ON_HAND_SCORED_END:
-            *joker_effect = &shared_joker_effect;
             effect_flags_ret = JOKER_EFFECT_FLAG_MESSAGE;
 
             (*p_hands_left_until_exp)--;
@@ -1775,12 +1741,12 @@ static u32 seltzer_joker_effect(
                 // So we can't use snprintf to craft a message depending on the number of hands left
                 static const char* seltzer_messages[] =
                     {"1", "2", "3", "4", "5", "6", "7", "8", "9"};
-                (*joker_effect)->message = (char*)seltzer_messages[(*p_hands_left_until_exp) - 1];
+                joker_effect->message = (char*)seltzer_messages[(*p_hands_left_until_exp) - 1];
             }
             else
             {
-                (*joker_effect)->message = "Drank!";
-                (*joker_effect)->expire = true;
+                joker_effect->message = "Drank!";
+                joker_effect->expire = true;
                 effect_flags_ret |= JOKER_EFFECT_FLAG_EXPIRE;
             }
             break;
@@ -1796,7 +1762,7 @@ static u32 sock_and_buskin_joker_effect(
     Joker* joker,
     Card* scored_card,
     enum JokerEvent joker_event,
-    JokerEffect** joker_effect
+    JokerEffect* joker_effect
 )
 {
     u32 effect_flags_ret = JOKER_EFFECT_FLAG_NONE;
@@ -1810,16 +1776,15 @@ static u32 sock_and_buskin_joker_effect(
             break;
 
         case JOKER_EVENT_ON_CARD_SCORED_END:
-            *joker_effect = &shared_joker_effect;
 
             // Works the same way as Dusk, but for face cards
-            (*joker_effect)->retrigger =
+            joker_effect->retrigger =
                 ((*p_last_retriggered_face_index < get_scored_card_index()) &&
                  card_is_face(scored_card));
-            if ((*joker_effect)->retrigger)
+            if (joker_effect->retrigger)
             {
                 *p_last_retriggered_face_index = get_scored_card_index();
-                (*joker_effect)->message = "Again!";
+                joker_effect->message = "Again!";
                 effect_flags_ret = JOKER_EFFECT_FLAG_RETRIGGER | JOKER_EFFECT_FLAG_MESSAGE;
             }
             break;
@@ -1831,10 +1796,9 @@ static u32 sock_and_buskin_joker_effect(
     return effect_flags_ret;
 }
 
-static u32 golden_joker_effect(Joker* joker, Card* scored_card, enum JokerEvent joker_event, JokerEffect** joker_effect) {
+static u32 golden_joker_effect(Joker* joker, Card* scored_card, enum JokerEvent joker_event, JokerEffect* joker_effect) {
     if (joker_event == JOKER_EVENT_ON_ROUND_END) {
-        *joker_effect = &shared_joker_effect;
-        (*joker_effect)->money = 4;             // Sets the payout
+        joker_effect->money = 4;             // Sets the payout
         return JOKER_EFFECT_FLAG_MONEY;         // Triggers the popup in joker.c
     }
     return JOKER_EFFECT_FLAG_NONE;
@@ -1844,15 +1808,14 @@ static u32 gros_michel_joker_effect(
     Joker* joker,
     Card* scored_card,
     enum JokerEvent joker_event,
-    JokerEffect** joker_effect
+    JokerEffect* joker_effect
 )
 {
     u32 effect_flags_ret = JOKER_EFFECT_FLAG_NONE;
 
     if (joker_event == JOKER_EVENT_INDEPENDENT)
     {
-        *joker_effect = &shared_joker_effect;
-        (*joker_effect)->mult = 15;
+        joker_effect->mult = 15;
         effect_flags_ret |= JOKER_EFFECT_FLAG_MULT;
     }
 
@@ -1860,9 +1823,8 @@ static u32 gros_michel_joker_effect(
     {
         if (random() % 6 == 0)
         {
-            *joker_effect = &shared_joker_effect;
-            (*joker_effect)->message = "Ext!";
-            (*joker_effect)->expire = true;
+            joker_effect->message = "Ext!";
+            joker_effect->expire = true;
             effect_flags_ret = (JOKER_EFFECT_FLAG_MESSAGE | JOKER_EFFECT_FLAG_EXPIRE);
         }
     }
@@ -1871,20 +1833,18 @@ static u32 gros_michel_joker_effect(
 static u32 cavendish_joker_effect(
     Joker* joker, Card* scored_card,
     enum JokerEvent joker_event,
-    JokerEffect** joker_effect
+    JokerEffect* joker_effect
 ) 
 {
     u32 flags = JOKER_EFFECT_FLAG_NONE;
     if (joker_event == JOKER_EVENT_INDEPENDENT) {
-        *joker_effect = &shared_joker_effect;
-        (*joker_effect)->xmult = 3; // Cavendish provides XMult
+        joker_effect->xmult = 3; // Cavendish provides XMult
         flags |= JOKER_EFFECT_FLAG_XMULT;
     }
     if (joker_event == JOKER_EVENT_ON_ROUND_END) {
         if (random() % 1000 == 0) { // 1 in 1000 chance to die
-            *joker_effect = &shared_joker_effect;
-            (*joker_effect)->message = "Extinct!";
-            (*joker_effect)->expire = true;
+            joker_effect->message = "Extinct!";
+            joker_effect->expire = true;
             flags |= (JOKER_EFFECT_FLAG_MESSAGE | JOKER_EFFECT_FLAG_EXPIRE);
         }
     }
@@ -1895,13 +1855,12 @@ static u32 supernova_joker_effect(
     Joker* joker, 
     Card* scored_card, 
     enum JokerEvent joker_event, 
-    JokerEffect** joker_effect
+    JokerEffect* joker_effect
 ) 
 {
     if (joker_event == JOKER_EVENT_INDEPENDENT) {
-        *joker_effect = &shared_joker_effect;
         // Mult equals the total hands played this run!
-        (*joker_effect)->mult = total_hands_played[*get_hand_type()];
+        joker_effect->mult = total_hands_played[*get_hand_type()];
         return JOKER_EFFECT_FLAG_MULT;
     }
     return JOKER_EFFECT_FLAG_NONE;
@@ -1911,7 +1870,7 @@ static u32 green_joker_effect(
     Joker* joker, 
     Card* scored_card, 
     enum JokerEvent joker_event, 
-    JokerEffect** joker_effect
+    JokerEffect* joker_effect
 ) 
 {
     u32 flags = JOKER_EFFECT_FLAG_NONE;
@@ -1929,8 +1888,7 @@ static u32 green_joker_effect(
 
     // Apply the Mult to the score
     if (joker_event == JOKER_EVENT_INDEPENDENT && *mult_bonus > 0) {
-        *joker_effect = &shared_joker_effect;
-        (*joker_effect)->mult = *mult_bonus;
+        joker_effect->mult = *mult_bonus;
         flags |= JOKER_EFFECT_FLAG_MULT;
     }
     return flags;
@@ -1940,7 +1898,7 @@ static u32 square_joker_effect(
     Joker* joker, 
     Card* scored_card, 
     enum JokerEvent joker_event, 
-    JokerEffect** joker_effect
+    JokerEffect* joker_effect
 ) 
 {
     u32 flags = JOKER_EFFECT_FLAG_NONE;
@@ -1960,8 +1918,7 @@ static u32 square_joker_effect(
 
     // Apply the Chips to the score
     if (joker_event == JOKER_EVENT_INDEPENDENT) {
-        *joker_effect = &shared_joker_effect;
-        (*joker_effect)->chips = *chips_bonus;
+        joker_effect->chips = *chips_bonus;
         flags |= JOKER_EFFECT_FLAG_CHIPS;
     }
     return flags;
@@ -1970,7 +1927,7 @@ static u32 smeared_joker_effect(
     Joker* joker, 
     Card* scored_card, 
     enum JokerEvent joker_event, 
-    JokerEffect** joker_effect
+    JokerEffect* joker_effect
 ) 
 {
     // Smeared Joker is purely passive and alters the engine's flush detection. 
@@ -1981,7 +1938,7 @@ static u32 flash_card_joker_effect(
     Joker* joker, 
     Card* scored_card, 
     enum JokerEvent joker_event, 
-    JokerEffect** joker_effect
+    JokerEffect* joker_effect
 ) 
 {
     u32 flags = JOKER_EFFECT_FLAG_NONE;
@@ -1992,8 +1949,7 @@ static u32 flash_card_joker_effect(
     }
 
     if (joker_event == JOKER_EVENT_INDEPENDENT && *mult_bonus > 0) {
-        *joker_effect = &shared_joker_effect;
-        (*joker_effect)->mult = *mult_bonus;
+        joker_effect->mult = *mult_bonus;
         flags |= JOKER_EFFECT_FLAG_MULT;
     }
     return flags;
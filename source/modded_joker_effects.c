@@ -9,26 +9,18 @@
 
 // #include "custom_joker_sheet_x.h" // Add this when you make IDs 1xx & 1xx!
 
-// Creates a local shared memory struct specifically for your modded cards to use
-static JokerEffect shared_joker_effect = {0};
-
 // Tells the compiler to go find this variable inside game.c
 extern int overkill_payout;
 #define MODDED_JOKER_START_ID 100
 #define NUM_JOKERS_PER_SPRITESHEET 2
 
-// --- 0. LOCAL EFFECT OBJECT ---
-// We use this local object so we don't conflict with the vanilla file's locked memory
-static JokerEffect modded_shared_joker_effect = {0};
-
-
 // --- 1. YOUR CUSTOM JOKER LOGIC ---
 
 static u32 mobius_joker_effect(
     Joker* joker, 
     Card* scored_card, 
     enum JokerEvent joker_event, 
-    JokerEffect** joker_effect
+    JokerEffect* joker_effect
 )
 {
     // You can add your actual Mobius logic here whenever you are ready!
@@ -39,18 +31,16 @@ static u32 last_dance_joker_effect(
     Joker* joker, 
     Card* scored_card, 
     enum JokerEvent joker_event, 
-    JokerEffect** joker_effect
+    JokerEffect* joker_effect
 )
 {
     if (joker_event == JOKER_EVENT_INDEPENDENT) {
-        // Point to our safe local variable
-        *joker_effect = &modded_shared_joker_effect;
         
         // x3 Total Mult
-        (*joker_effect)->xmult = 3; 
+        joker_effect->xmult = 3; 
         
         // x2 Total Chips (By adding 100% of our current chips to the pool!)
-        (*joker_effect)->chips = get_chips(); 
+        joker_effect->chips = get_chips(); 
         
         return JOKER_EFFECT_FLAG_XMULT | JOKER_EFFECT_FLAG_CHIPS;
     }
@@ -62,7 +52,7 @@ static u32 jaker_joker_effect(
     Joker* joker, 
     Card* scored_card, 
     enum JokerEvent joker_event, 
-    JokerEffect** joker_effect
+    JokerEffect* joker_effect
 )
 {
     // Jaker modifies hands at the start of the round, so his scoring effect is empty!
@@ -73,7 +63,7 @@ static u32 voor_joker_effect(
     Joker* joker, 
     Card* scored_card, 
     enum JokerEvent joker_event, 
-    JokerEffect** joker_effect
+    JokerEffect* joker_effect
 )
 {
     // Start with 2 Mult when conjured or bought
@@ -83,8 +73,7 @@ static u32 voor_joker_effect(
     
     // Add the stored Mult to the score!
     if (joker_event == JOKER_EVENT_INDEPENDENT && joker->persistent_state > 0) {
-        *joker_effect = &modded_shared_joker_effect;
-        (*joker_effect)->mult = joker->persistent_state; 
+        joker_effect->mult = joker->persistent_state; 
         return JOKER_EFFECT_FLAG_MULT;
     }
     return JOKER_EFFECT_FLAG_NONE; 
@@ -93,7 +82,7 @@ static u32 voor_joker_effect(
 static u32 capacocha_joker_effect(Joker* joker, 
     Card* scored_card, 
     enum JokerEvent joker_event, 
-    JokerEffect** joker_effect
+    JokerEffect* joker_effect
 ) 
 {
     if (joker_event == JOKER_EVENT_ON_JOKER_CREATED) {
@@ -103,9 +92,8 @@ static u32 capacocha_joker_effect(Joker* joker,
     // Check for expiration at the end of the round
     if (joker_event == JOKER_EVENT_ON_ROUND_END) {
         if (joker->persistent_state <= 0) {
-            *joker_effect = &shared_joker_effect;
-            (*joker_effect)->message = "Sacrificed!";
-            (*joker_effect)->expire = true;
+            joker_effect->message = "Sacrificed!";
+            joker_effect->expire = true;
             return JOKER_EFFECT_FLAG_MESSAGE | JOKER_EFFECT_FLAG_EXPIRE;
         }
     }
@@ -115,13 +103,12 @@ static u32 capacocha_joker_effect(Joker* joker,
 static u32 overkill_joker_effect(Joker* joker, 
     Card* scored_card, 
     enum JokerEvent joker_event, 
-    JokerEffect** joker_effect
+    JokerEffect* joker_effect
 ) 
 {
     if (joker_event == JOKER_EVENT_ON_ROUND_END) {
         if (overkill_payout > 0) {
-            *joker_effect = &shared_joker_effect;
-            (*joker_effect)->money = overkill_payout; // The engine reads this directly
+            joker_effect->money = overkill_payout; // The engine reads this directly
             return JOKER_EFFECT_FLAG_MONEY;           // Triggers the popup in joker.c
         }
     }
@@ -133,7 +120,7 @@ static u32 overkill_joker_effect(Joker* joker,
 static u32 jamming_joker_effect(Joker* joker, 
     Card* scored_card, 
     enum JokerEvent joker_event, 
-    JokerEffect** joker_effect
+    JokerEffect* joker_effect
 ) 
 {
     // Passive: Logic handled externally during AI's turn
@@ -143,7 +130,7 @@ static u32 jamming_joker_effect(Joker* joker,
 static u32 captcha_joker_effect(Joker* joker, 
     Card* scored_card, 
     enum JokerEvent joker_event, 
-    JokerEffect** joker_effect
+    JokerEffect* joker_effect
 ) 
 {
     // Passive: Logic handled externally during AI's scoring loop
@@ -153,7 +140,7 @@ static u32 captcha_joker_effect(Joker* joker,
 static u32 ddos_joker_effect(Joker* joker, 
     Card* scored_card, 
     enum JokerEvent joker_event, 
-    JokerEffect** joker_effect
+    JokerEffect* joker_effect
 ) 
 {
     return JOKER_EFFECT_FLAG_NONE; // Passive: Handled at AI Turn Start
@@ -162,7 +149,7 @@ static u32 ddos_joker_effect(Joker* joker,
 static u32 trojan_joker_effect(Joker* joker, 
     Card* scored_card, 
     enum JokerEvent joker_event, 
-    JokerEffect** joker_effect
+    JokerEffect* joker_effect
 ) 
 {
     return JOKER_EFFECT_FLAG_NONE; // Passive: Handled at Score Compare
@@ -174,19 +161,33 @@ static u32 trojan_joker_effect(Joker* joker,
 // So Index 0 is ID 100 (Mobius), Index 1 is ID 101 (Last Dance).
 // Because we set NUM_JOKERS_PER_SPRITESHEET to 2, 
 // Mobius reads the Left half, Last Dance reads the Right half!
+// The last column lists the events each effect reacts to, see JokerInfo.event_mask.
+// Passive jokers handled by the engine react to none.
+
+// Same shorthands for the event masks as the vanilla registry in joker_effects.c
+#define NO_EVENTS    0
+#define ON_CREATED   JOKER_EVENT_BIT(JOKER_EVENT_ON_JOKER_CREATED)
+#define INDEPENDENT  JOKER_EVENT_BIT(JOKER_EVENT_INDEPENDENT)
+#define ON_ROUND_END JOKER_EVENT_BIT(JOKER_EVENT_ON_ROUND_END)
+
 const JokerInfo modded_joker_registry[] = {
-    { UNCOMMON_JOKER,        7,      mobius_joker_effect           }, // Index 0 -> ID 100 (Mobius)
-    { RARE_JOKER,            20,     last_dance_joker_effect       }, // Index 1 -> ID 101 (Last Dance)
-    { COMMON_JOKER,          7,      voor_joker_effect             }, // Index 2 -> ID 102 (Voor)
-    { UNCOMMON_JOKER,        10,     jaker_joker_effect            }, // Index 3 -> ID 103 (Jaker)
-    { RARE_JOKER,            18,     capacocha_joker_effect        }, // Index 4 -> ID 104 (Capacocha)
-    { COMMON_JOKER,          6,      overkill_joker_effect         }, // Index 5 -> ID 105 (Overkill)
-    { RARE_JOKER,            17,     jamming_joker_effect          }, // ID 106 (Jamming) Clanker
-    { RARE_JOKER,            13,     captcha_joker_effect          }, // ID 107 (CaptchA) Clanker
-    { RARE_JOKER,            15,     ddos_joker_effect             }, // ID 108 (DDoS Attack)
-    { UNCOMMON_JOKER,        12,     trojan_joker_effect           }, // ID 109 (Trojan Joker)
+    { UNCOMMON_JOKER,        7,      mobius_joker_effect,          NO_EVENTS                  }, // Index 0 -> ID 100 (Mobius)
+    { RARE_JOKER,            20,     last_dance_joker_effect,      INDEPENDENT                }, // Index 1 -> ID 101 (Last Dance)
+    { COMMON_JOKER,          7,      voor_joker_effect,            ON_CREATED | INDEPENDENT   }, // Index 2 -> ID 102 (Voor)
+    { UNCOMMON_JOKER,        10,     jaker_joker_effect,           NO_EVENTS                  }, // Index 3 -> ID 103 (Jaker)
+    { RARE_JOKER,            18,     capacocha_joker_effect,       ON_CREATED | ON_ROUND_END  }, // Index 4 -> ID 104 (Capacocha)
+    { COMMON_JOKER,          6,      overkill_joker_effect,        ON_ROUND_END               }, // Index 5 -> ID 105 (Overkill)
+    { RARE_JOKER,            17,     jamming_joker_effect,         NO_EVENTS                  }, // ID 106 (Jamming) Clanker
+    { RARE_JOKER,            13,     captcha_joker_effect,         NO_EVENTS                  }, // ID 107 (CaptchA) Clanker
+    { RARE_JOKER,            15,     ddos_joker_effect,            NO_EVENTS                  }, // ID 108 (DDoS Attack)
+    { UNCOMMON_JOKER,        12,     trojan_joker_effect,          NO_EVENTS                  }, // ID 109 (Trojan Joker)
 };
 
+#undef NO_EVENTS
+#undef ON_CREATED
+#undef INDEPENDENT
+#undef ON_ROUND_END
+
 
 // --- 3. HELPER FUNCTIONS FOR THE ENGINE ---
 // (Do not change these! The vanilla game uses them to read your mods safely)
@@ -0,0 +1,382 @@
+/*
+ * AI tournament: plays simulated rounds with every AI level over a range of seeds and writes one
+ * CSV line per level with its win rate, average score and decisions per second, to tune AI
+ * strength against CPU cost without hardware.
+ *
+ * Every seed deals the same deck and the same jokers to every level. The jokers are drawn from the
+ * game's vanilla registry and scored by the game's own joker code, see game_env.c, so the rule
+ * bending ones like Four Fingers and Shortcut come up too.
+ *
+ * The seeds are split across one worker per core. Workers are forked processes rather than threads:
+ * like on the GBA, the AI, the jokers and the pools keep their state in file-scope variables, and
+ * separate address spaces give every worker its own copy without touching the game code.
+ *
+ * The hardware timers never tick on the host, so the levels' cycle budgets never cut a search
+ * short. The decisions per second column shows what each level costs instead.
+ */
+#include "game_env.h"
+
+#include <ai_player.h>
+#include <deck_composition.h>
+#include <game.h>
+#include <hand_eval.h>
+#include <joker.h>
+#include <list.h>
+#include <util.h>
+
+#include <getopt.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/wait.h>
+#include <time.h>
+#include <unistd.h>
+
+#define ROUND_HANDS            4
+#define ROUND_DISCARDS         3
+#define ROUND_HAND_SIZE        8
+#define MAX_DISCARDS_PER_CYCLE 2 // Mirrors AI_MAX_DISCARDS_PER_CYCLE in game.c
+#define MAX_ROUND_JOKERS       3
+
+#define DEFAULT_FIRST_SEED   1
+#define DEFAULT_NUM_SEEDS    1000
+#define DEFAULT_TARGET_SCORE 800 // Small blind of the second ante
+
+// Defined in modded_joker_effects.c
+extern size_t get_modded_registry_size(void);
+
+typedef struct
+{
+    uint64_t rounds;
+    uint64_t wins;
+    uint64_t total_score;
+    uint64_t decisions;
+    uint64_t decision_ns;
+} PolicyStats;
+
+static Card cards[MAX_DECK_SIZE];
+
+static u32 xorshift32(u32* state)
+{
+    u32 x = *state;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    *state = x;
+    return x;
+}
+
+static uint64_t now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+/* ---- Rounds ---- */
+
+typedef struct
+{
+    Card* deck[MAX_DECK_SIZE];
+    int deck_top;
+    DeckComposition deck_comp;
+    Card* hand[ROUND_HAND_SIZE];
+    int hand_count;
+} Round;
+
+static void round_draw(Round* round)
+{
+    while (round->hand_count < ROUND_HAND_SIZE && round->deck_top >= 0)
+    {
+        Card* card = round->deck[round->deck_top--];
+        deck_comp_remove(&round->deck_comp, card);
+        round->hand[round->hand_count++] = card;
+    }
+}
+
+// Moves the flagged cards out of the hand, keeping the order of the others
+static int round_take_cards(Round* round, const bool* flags, Card** out_cards)
+{
+    int num_taken = 0;
+    int num_kept = 0;
+    for (int i = 0; i < round->hand_count; i++)
+    {
+        if (flags[i])
+            out_cards[num_taken++] = round->hand[i];
+        else
+            round->hand[num_kept++] = round->hand[i];
+    }
+    round->hand_count = num_kept;
+    return num_taken;
+}
+
+// Deals the deck and the jokers of a seed, the same for every level
+static void round_deal(Round* round, u32 seed)
+{
+    u32 rng = seed * 2654435761u + 1;
+
+    round->deck_top = -1;
+    for (int i = 0; i < MAX_DECK_SIZE; i++)
+        round->deck[++round->deck_top] = &cards[i];
+
+    for (int i = round->deck_top; i > 0; i--)
+    {
+        int j = xorshift32(&rng) % (i + 1);
+        Card* temp = round->deck[i];
+        round->deck[i] = round->deck[j];
+        round->deck[j] = temp;
+    }
+    deck_comp_from_cards(&round->deck_comp, round->deck, round->deck_top + 1);
+
+    // Jokers from the vanilla registry, like the shop offers them without the custom jokers
+    int num_vanilla_jokers = get_joker_registry_size() - get_modded_registry_size();
+    u8 joker_ids[MAX_ROUND_JOKERS];
+    int num_jokers = xorshift32(&rng) % (MAX_ROUND_JOKERS + 1);
+    for (int i = 0; i < num_jokers; i++)
+    {
+        bool duplicate;
+        do
+        {
+            joker_ids[i] = xorshift32(&rng) % num_vanilla_jokers;
+            duplicate = false;
+            for (int k = 0; k < i; k++)
+                duplicate |= joker_ids[k] == joker_ids[i];
+        } while (duplicate);
+    }
+
+    // The joker effects that roll dice (Misprint, Business Card...) use the game's random()
+    srandom(seed);
+    game_env_start_round(joker_ids, num_jokers, ROUND_HANDS, ROUND_DISCARDS);
+
+    round->hand_count = 0;
+    round_draw(round);
+}
+
+static void play_round(u32 seed, u32 target_score, PolicyStats* stats)
+{
+    Round round;
+    round_deal(&round, seed);
+    ai_planner_seed(seed);
+
+    int hands = ROUND_HANDS;
+    int discards = ROUND_DISCARDS;
+    int discards_this_cycle = 0;
+    u32 score = 0;
+
+    // Every hand is played out so the average score keeps telling the levels apart
+    while (hands > 0 && round.hand_count > 0)
+    {
+        game_env_set_deck_top(round.deck_top);
+
+        bool sel[MAX_HAND_SIZE] = {false};
+        bool discard_sel[MAX_HAND_SIZE] = {false};
+        enum HandType best_hand_type = NONE;
+        int discard_count = 0;
+
+        uint64_t start = now_ns();
+        int best_count = ai_select_best_hand(round.hand, round.hand_count, sel, &best_hand_type);
+        if (discards_this_cycle < MAX_DISCARDS_PER_CYCLE && discards > 0 &&
+            best_count < round.hand_count)
+        {
+            discard_count = ai_choose_discard(
+                round.hand,
+                round.hand_count,
+                sel,
+                best_hand_type,
+                discards_this_cycle,
+                round.deck,
+                round.deck_top + 1,
+                &round.deck_comp,
+                discard_sel
+            );
+        }
+        stats->decision_ns += now_ns() - start;
+        stats->decisions++;
+
+        Card* taken[ROUND_HAND_SIZE];
+        if (discard_count > 0)
+        {
+            round_take_cards(&round, discard_sel, taken);
+            game_env_discard();
+            discards--;
+            discards_this_cycle++;
+        }
+        else
+        {
+            int num_played = round_take_cards(&round, sel, taken);
+            u32 hand_score = game_env_play_hand(taken, num_played, round.hand, round.hand_count);
+            score = u32_protected_add(score, hand_score);
+            hands--;
+            discards_this_cycle = 0;
+        }
+
+        round_draw(&round);
+    }
+
+    stats->rounds++;
+    stats->total_score += score;
+    if (score >= target_score)
+        stats->wins++;
+}
+
+/* ---- Workers ---- */
+
+static void run_worker(
+    int worker,
+    int num_workers,
+    u32 first_seed,
+    u32 num_seeds,
+    u32 target_score,
+    PolicyStats* stats
+)
+{
+    for (int level = 0; level < AI_NUM_LEVELS; level++)
+    {
+        ai_set_level(level);
+        for (u32 i = worker; i < num_seeds; i += num_workers)
+            play_round(first_seed + i, target_score, &stats[level]);
+    }
+}
+
+static void write_csv(FILE* out, const PolicyStats* stats)
+{
+    fprintf(out, "level,rounds,win_rate,avg_score,decisions_per_sec\n");
+    for (int level = 0; level < AI_NUM_LEVELS; level++)
+    {
+        const PolicyStats* s = &stats[level];
+        double rounds = s->rounds ? (double)s->rounds : 1.0;
+        double seconds = s->decision_ns ? s->decision_ns / 1e9 : 1.0;
+        fprintf(
+            out,
+            "%s,%llu,%.4f,%.1f,%.0f\n",
+            ai_get_level_info(level)->name,
+            (unsigned long long)s->rounds,
+            s->wins / rounds,
+            s->total_score / rounds,
+            s->decisions / seconds
+        );
+    }
+}
+
+static void usage(const char* prog)
+{
+    fprintf(
+        stderr,
+        "usage: %s [-s first_seed] [-n num_seeds] [-j jobs] [-t target_score] [-o out.csv]\n",
+        prog
+    );
+}
+
+int main(int argc, char** argv)
+{
+    u32 first_seed = DEFAULT_FIRST_SEED;
+    u32 num_seeds = DEFAULT_NUM_SEEDS;
+    u32 target_score = DEFAULT_TARGET_SCORE;
+    long num_workers = sysconf(_SC_NPROCESSORS_ONLN);
+    const char* out_path = NULL;
+
+    int opt;
+    while ((opt = getopt(argc, argv, "s:n:j:t:o:h")) != -1)
+    {
+        switch (opt)
+        {
+            case 's':
+                first_seed = strtoul(optarg, NULL, 0);
+                break;
+            case 'n':
+                num_seeds = strtoul(optarg, NULL, 0);
+                break;
+            case 'j':
+                num_workers = strtol(optarg, NULL, 0);
+                break;
+            case 't':
+                target_score = strtoul(optarg, NULL, 0);
+                break;
+            case 'o':
+                out_path = optarg;
+                break;
+            default:
+                usage(argv[0]);
+                return opt == 'h' ? 0 : 1;
+        }
+    }
+
+    if (num_workers < 1)
+        num_workers = 1;
+    if (num_workers > num_seeds && num_seeds > 0)
+        num_workers = num_seeds;
+
+    for (int suit = 0; suit < NUM_SUITS; suit++)
+    {
+        for (int rank = 0; rank < NUM_RANKS; rank++)
+            cards[suit * NUM_RANKS + rank] = (Card){.suit = suit, .rank = rank};
+    }
+
+    // Each worker sends its stats back through its own pipe once it's done
+    int pipes[num_workers];
+    pid_t pids[num_workers];
+    for (int w = 0; w < num_workers; w++)
+    {
+        int fds[2];
+        if (pipe(fds) != 0)
+        {
+            perror("pipe");
+            return 1;
+        }
+
+        pids[w] = fork();
+        if (pids[w] < 0)
+        {
+            perror("fork");
+            return 1;
+        }
+
+        if (pids[w] == 0)
+        {
+            close(fds[0]);
+            PolicyStats stats[AI_NUM_LEVELS] = {0};
+            run_worker(w, num_workers, first_seed, num_seeds, target_score, stats);
+            bool written = write(fds[1], stats, sizeof(stats)) == sizeof(stats);
+            _exit(written ? 0 : 1);
+        }
+
+        close(fds[1]);
+        pipes[w] = fds[0];
+    }
+
+    PolicyStats totals[AI_NUM_LEVELS] = {0};
+    int failed = 0;
+    for (int w = 0; w < num_workers; w++)
+    {
+        PolicyStats stats[AI_NUM_LEVELS];
+        if (read(pipes[w], stats, sizeof(stats)) != sizeof(stats))
+        {
+            fprintf(stderr, "worker %d sent no results\n", w);
+            failed = 1;
+        }
+        else
+        {
+            for (int level = 0; level < AI_NUM_LEVELS; level++)
+            {
+                totals[level].rounds += stats[level].rounds;
+                totals[level].wins += stats[level].wins;
+                totals[level].total_score += stats[level].total_score;
+                totals[level].decisions += stats[level].decisions;
+                totals[level].decision_ns += stats[level].decision_ns;
+            }
+        }
+        close(pipes[w]);
+        waitpid(pids[w], NULL, 0);
+    }
+
+    FILE* out = out_path ? fopen(out_path, "w") : stdout;
+    if (out == NULL)
+    {
+        perror(out_path);
+        return 1;
+    }
+    write_csv(out, totals);
+    if (out != stdout)
+        fclose(out);
+
+    return failed;
+}
@@ -0,0 +1,4 @@
+// Host stand-in for a modded joker spritesheet grit generates in the GBA build, see tonc.h
+#ifndef AI_TOURNAMENT_CUSTOM_JOKER_SHEET_3_H
+#define AI_TOURNAMENT_CUSTOM_JOKER_SHEET_3_H
+#endif // AI_TOURNAMENT_CUSTOM_JOKER_SHEET_3_H
@@ -0,0 +1,8 @@
+// Host stand-in for the card spritesheet grit generates in the GBA build, see tonc.h
+#ifndef AI_TOURNAMENT_DECK_GFX_H
+#define AI_TOURNAMENT_DECK_GFX_H
+
+extern const unsigned int deck_gfxTiles[];
+extern const unsigned short deck_gfxPal[16];
+
+#endif // AI_TOURNAMENT_DECK_GFX_H
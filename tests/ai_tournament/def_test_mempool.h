@@ -0,0 +1,10 @@
+#include "card.h"
+#include "joker.h"
+#include "list.h"
+#include <stddef.h>
+
+POOL_ENTRY(Joker, MAX_ACTIVE_JOKERS);
+POOL_ENTRY(JokerObject, MAX_ACTIVE_JOKERS);
+POOL_ENTRY(Card, MAX_CARDS);
+POOL_ENTRY(CardObject, MAX_CARDS_ON_SCREEN);
+POOL_ENTRY(ListNode, MAX_LIST_NODES);
@@ -0,0 +1,436 @@
+/*
+ * Host stand-ins for the game.c functions the AI and the jokers call, backed by the state of the
+ * simulated round in ai_tournament.c.
+ *
+ * The jokers are the game's own: joker.c, joker_effects.c and modded_joker_effects.c are linked as
+ * they are and only their presentation is stubbed, see presentation_stubs.c. A played hand goes
+ * through the same joker events, in the same order, as the PLAY_SCORING_* states of game.c.
+ *
+ * Like in game.c, the scoring getters report the hand of the current ScorePreview while the AI
+ * rescores a subset with the jokers, and the hand being played otherwise.
+ */
+#include "game_env.h"
+
+#include <ai_player.h>
+#include <card.h>
+#include <game.h>
+#include <hand_eval.h>
+#include <joker.h>
+#include <list.h>
+#include <util.h>
+
+volatile u16 REG_TM2D, REG_TM2CNT, REG_TM3D, REG_TM3CNT;
+
+// Globals of game.c read by the joker effects
+int total_hands_played[16];
+int overkill_payout = 0;
+
+static List owned_jokers;
+static List expired_jokers;
+static bool lists_created = false;
+static u8 owned_joker_counts[MAX_DEFINABLE_JOKERS];
+
+// Same per-event dispatch lists as game.c, see update_joker_event_subscribers() there
+static JokerObject* joker_event_subscribers[NUM_JOKER_EVENTS][MAX_ACTIVE_JOKERS];
+static u8 joker_event_subscriber_counts[NUM_JOKER_EVENTS];
+
+static RuleSet rule_set;
+static HandEvalFunc hand_eval_func;
+
+static ScorePreview* score_preview = NULL;
+
+static int money = GAME_ENV_STARTING_MONEY;
+static int hands = 0;
+static int discards = 0;
+static int deck_top = -1;
+
+// The hand being played, see game_env_play_hand()
+static CardObject* played[MAX_SELECTION_SIZE];
+static int played_top = -1;
+static CardObject* hand[MAX_HAND_SIZE];
+static int hand_top = -1;
+static int scored_card_index = 0;
+static ContainedHandTypes contained_hands;
+static enum HandType hand_type = NONE;
+static u32 chips = 0;
+static u32 mult = 0;
+static bool retrigger = false;
+
+/* ---- Owned jokers, following add_owned_joker() and remove_owned_joker() of game.c ---- */
+
+static void update_joker_event_subscribers(void)
+{
+    for (int joker_event = 0; joker_event < NUM_JOKER_EVENTS; joker_event++)
+        joker_event_subscriber_counts[joker_event] = 0;
+
+    ListItr itr = list_itr_create(&owned_jokers);
+    JokerObject* joker_object;
+    while ((joker_object = list_itr_next(&itr)))
+    {
+        u16 event_mask = joker_get_event_mask(joker_object->joker);
+        for (int joker_event = 0; joker_event < NUM_JOKER_EVENTS; joker_event++)
+        {
+            u8* count = &joker_event_subscriber_counts[joker_event];
+            if ((event_mask & JOKER_EVENT_BIT(joker_event)) && *count < MAX_ACTIVE_JOKERS)
+                joker_event_subscribers[joker_event][(*count)++] = joker_object;
+        }
+    }
+}
+
+static void on_owned_jokers_changed(void)
+{
+    joker_build_rule_set(&rule_set);
+    hand_eval_func = hand_eval_select_variant(&rule_set);
+    ai_score_cache_clear();
+
+    joker_resolve_copy_targets(&owned_jokers);
+    update_joker_event_subscribers();
+}
+
+static void clear_owned_jokers(void)
+{
+    JokerObject* joker_object;
+    while ((joker_object = list_get_at_idx(&owned_jokers, 0)))
+    {
+        owned_joker_counts[joker_object->joker->id]--;
+        list_remove_at_idx(&owned_jokers, 0);
+        joker_object_destroy(&joker_object);
+    }
+    list_clear(&expired_jokers);
+}
+
+// Expired jokers leave once the hand is scored, like expired_jokers_update_loop() in game.c
+static void remove_expired_jokers(void)
+{
+    if (list_is_empty(&expired_jokers))
+        return;
+
+    ListItr itr = list_itr_create(&expired_jokers);
+    JokerObject* joker_object;
+    while ((joker_object = list_itr_next(&itr)))
+    {
+        int expired_joker_idx = 0;
+        ListItr joker_itr = list_itr_create(&owned_jokers);
+        JokerObject* owned_joker;
+        while ((owned_joker = list_itr_next(&joker_itr)) && owned_joker != joker_object)
+            expired_joker_idx++;
+
+        owned_joker_counts[joker_object->joker->id]--;
+        list_remove_at_idx(&owned_jokers, expired_joker_idx);
+        list_itr_remove_current_node(&itr);
+        joker_object_destroy(&joker_object);
+    }
+
+    on_owned_jokers_changed();
+}
+
+/* ---- Round ---- */
+
+void game_env_start_round(const u8* joker_ids, int num_jokers, int hands_left, int discards_left)
+{
+    if (!lists_created)
+    {
+        joker_init();
+        owned_jokers = list_create();
+        expired_jokers = list_create();
+        lists_created = true;
+    }
+
+    clear_owned_jokers();
+
+    money = GAME_ENV_STARTING_MONEY;
+    hands = hands_left;
+    discards = discards_left;
+    overkill_payout = 0;
+    for (int i = 0; i < NUM_ELEM_IN_ARR(total_hands_played); i++)
+        total_hands_played[i] = 0;
+
+    for (int i = 0; i < num_jokers && i < GAME_ENV_MAX_JOKERS; i++)
+    {
+        Joker* joker = joker_new(joker_ids[i]);
+        if (joker == NULL)
+            continue;
+
+        list_push_back(&owned_jokers, joker_object_new(joker));
+        owned_joker_counts[joker->id]++;
+    }
+
+    on_owned_jokers_changed();
+}
+
+void game_env_set_deck_top(int new_deck_top)
+{
+    deck_top = new_deck_top;
+}
+
+void game_env_discard(void)
+{
+    // Green Joker hook of game_playing_execute_discard()
+    ListItr itr = list_itr_create(&owned_jokers);
+    JokerObject* joker_object;
+    while ((joker_object = list_itr_next(&itr)))
+    {
+        if (joker_object->joker->id == 56 && joker_object->joker->persistent_state > 0) // Green
+            joker_object->joker->persistent_state -= 1;
+    }
+
+    discards--;
+}
+
+/* ---- Scoring, following the PLAY_SCORING_* states of game.c ---- */
+
+// Same as check_and_score_joker_for_event() in game.c, the AI is always the one playing
+static bool check_and_score_joker_for_event(
+    int* joker_idx,
+    CardObject* card_object,
+    enum JokerEvent joker_event
+)
+{
+    while (*joker_idx < joker_event_subscriber_counts[joker_event])
+    {
+        JokerObject* joker = joker_event_subscribers[joker_event][(*joker_idx)++];
+
+        // Jamming hook
+        if (is_joker_owned(JAMMING_JOKER_ID) && joker == list_get_at_idx(&owned_jokers, 0))
+            continue;
+
+        if (joker_object_score(joker, card_object, joker_event))
+            return true;
+    }
+    return false;
+}
+
+// Scores every joker subscribed to an event, the game spreads these over frames
+static void score_jokers_for_event(CardObject* card_object, enum JokerEvent joker_event)
+{
+    int joker_idx = 0;
+    while (check_and_score_joker_for_event(&joker_idx, card_object, joker_event))
+        ;
+}
+
+static void score_played_card(CardObject* card_object)
+{
+    bool retriggered;
+    do
+    {
+        // PLAY_SCORING_CARDS
+        u8 card_value = card_get_value(card_object->card);
+        if (is_joker_owned(CAPTCHA_JOKER_ID) && card_is_face(card_object->card))
+            card_value = 0; // CaptchA hook
+
+        chips = u32_protected_add(chips, card_value);
+
+        // PLAY_SCORING_CARD_JOKERS, a retrigger goes back to PLAY_SCORING_CARDS for the same card
+        score_jokers_for_event(card_object, JOKER_EVENT_ON_CARD_SCORED);
+
+        retriggered = false;
+        int joker_card_scored_end_idx = 0;
+        while (!retriggered && check_and_score_joker_for_event(
+                                   &joker_card_scored_end_idx,
+                                   card_object,
+                                   JOKER_EVENT_ON_CARD_SCORED_END
+                               ))
+        {
+            retriggered = retrigger;
+            retrigger = false;
+        }
+    } while (retriggered);
+}
+
+u32 game_env_play_hand(Card** played_cards, int num_played, Card** held_cards, int num_held)
+{
+    HandBitboard bb;
+    hand_bitboard_from_cards(&bb, played_cards, num_played);
+
+    // set_hand() and game_playing_execute_play_hand()
+    contained_hands = hand_eval_func(&bb, &rule_set);
+    hand_type = hand_eval_highest_type(contained_hands);
+    chips = hand_eval_base_values(hand_type)->chips;
+    mult = hand_eval_base_values(hand_type)->mult;
+    hands--;
+    total_hands_played[hand_type]++;
+
+    played_top = -1;
+    for (int i = 0; i < num_played && i < MAX_SELECTION_SIZE; i++)
+        played[++played_top] = card_object_new(played_cards[i]);
+
+    hand_top = -1;
+    for (int i = 0; i < num_held && i < MAX_HAND_SIZE; i++)
+        hand[++hand_top] = card_object_new(held_cards[i]);
+
+    // select_cards_in_played_hand()
+    uint8_t scoring_mask =
+        hand_eval_scoring_mask(&bb, played_cards, played_top + 1, hand_type, &rule_set);
+    for (int i = 0; i <= played_top; i++)
+        card_object_set_selected(played[i], (scoring_mask >> i) & 0x1);
+
+    // PLAY_BEFORE_SCORING
+    scored_card_index = 0;
+    score_jokers_for_event(NULL, JOKER_EVENT_ON_HAND_PLAYED);
+
+    for (scored_card_index = 0; scored_card_index <= played_top; scored_card_index++)
+    {
+        if (card_object_is_selected(played[scored_card_index]))
+            score_played_card(played[scored_card_index]);
+    }
+
+    // PLAY_SCORING_HELD_CARDS
+    for (scored_card_index = hand_top; scored_card_index >= 0; scored_card_index--)
+        score_jokers_for_event(hand[scored_card_index], JOKER_EVENT_ON_CARD_HELD);
+
+    // PLAY_SCORING_INDEPENDENT_JOKERS
+    scored_card_index = 0;
+    score_jokers_for_event(NULL, JOKER_EVENT_INDEPENDENT);
+
+    // PLAY_SCORING_HAND_SCORED_END
+    scored_card_index = played_top + 1;
+    score_jokers_for_event(NULL, JOKER_EVENT_ON_HAND_SCORED_END);
+
+    u32 score = u32_protected_mult(chips, mult);
+
+    for (int i = 0; i <= played_top; i++)
+        card_object_destroy(&played[i]);
+    for (int i = 0; i <= hand_top; i++)
+        card_object_destroy(&hand[i]);
+    played_top = -1;
+    hand_top = -1;
+    scored_card_index = 0;
+
+    remove_expired_jokers();
+
+    return score;
+}
+
+/* ---- Functions of game.c the AI and the jokers link against ---- */
+
+List* get_jokers_list(void)
+{
+    return &owned_jokers;
+}
+
+List* get_expired_jokers_list(void)
+{
+    return &expired_jokers;
+}
+
+int count_jokers_owned(int joker_id)
+{
+    if (joker_id < 0 || joker_id >= MAX_DEFINABLE_JOKERS)
+        return 0;
+    return owned_joker_counts[joker_id];
+}
+
+bool is_joker_owned(int joker_id)
+{
+    return count_jokers_owned(joker_id) > 0;
+}
+
+const RuleSet* get_rule_set(void)
+{
+    return &rule_set;
+}
+
+bool card_is_face(Card* card)
+{
+    return rule_set_card_is_face(&rule_set, card);
+}
+
+void game_set_score_preview(ScorePreview* preview)
+{
+    score_preview = preview;
+}
+
+bool game_is_score_preview(void)
+{
+    return score_preview != NULL;
+}
+
+CardObject** get_hand_array(void)
+{
+    return score_preview ? score_preview->held : hand;
+}
+
+int get_hand_top(void)
+{
+    return score_preview ? score_preview->held_top : hand_top;
+}
+
+int hand_get_size(void)
+{
+    return get_hand_top() + 1;
+}
+
+CardObject** get_played_array(void)
+{
+    return played;
+}
+
+int get_played_top(void)
+{
+    return score_preview ? score_preview->played_top : played_top;
+}
+
+int get_scored_card_index(void)
+{
+    return score_preview ? score_preview->scored_card_index : scored_card_index;
+}
+
+ContainedHandTypes* get_contained_hands(void)
+{
+    return score_preview ? &score_preview->contained_hands : &contained_hands;
+}
+
+enum HandType* get_hand_type(void)
+{
+    return score_preview ? &score_preview->hand_type : &hand_type;
+}
+
+u32 get_chips(void)
+{
+    return score_preview ? score_preview->chips : chips;
+}
+
+void set_chips(u32 new_chips)
+{
+    chips = new_chips;
+}
+
+u32 get_mult(void)
+{
+    return score_preview ? score_preview->mult : mult;
+}
+
+void set_mult(u32 new_mult)
+{
+    mult = new_mult;
+}
+
+int get_money(void)
+{
+    return money;
+}
+
+void set_money(int new_money)
+{
+    money = new_money;
+}
+
+void set_retrigger(bool new_retrigger)
+{
+    retrigger = new_retrigger;
+}
+
+int get_deck_top(void)
+{
+    return deck_top;
+}
+
+int get_num_discards_remaining(void)
+{
+    return discards;
+}
+
+int get_num_hands_remaining(void)
+{
+    return hands;
+}
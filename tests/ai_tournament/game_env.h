@@ -0,0 +1,26 @@
+/*
+ * Simulated game state the AI and the jokers read through game_env.c
+ */
+#ifndef GAME_ENV_H
+#define GAME_ENV_H
+
+#include <card.h>
+#include <tonc.h>
+
+#define GAME_ENV_MAX_JOKERS     5
+#define GAME_ENV_STARTING_MONEY 4 // Mirrors STARTING_MONEY in game.c
+
+// Starts a round with the given owned jokers and counters, replacing those of the previous round
+void game_env_start_round(const u8* joker_ids, int num_jokers, int hands, int discards);
+
+// Keeps get_deck_top() in step with the simulated deck
+void game_env_set_deck_top(int deck_top);
+
+// Discards a hand, mirrors game_playing_execute_discard()
+void game_env_discard(void);
+
+// Plays a hand and scores it through the same joker events as the PLAY_SCORING_* states of game.c,
+// held are the cards left in hand. Returns the score of the hand
+u32 game_env_play_hand(Card** played_cards, int num_played, Card** held_cards, int num_held);
+
+#endif // GAME_ENV_H
@@ -0,0 +1,15 @@
+// Host stand-in for the joker spritesheets grit generates in the GBA build, see tonc.h
+#ifndef AI_TOURNAMENT_JOKER_GFX_H
+#define AI_TOURNAMENT_JOKER_GFX_H
+
+#define JOKER_GFX_TILES_LEN 512
+
+// clang-format off
+#define DEF_JOKER_GFX(idx)                                                   \
+    extern const unsigned int joker_gfx##idx##Tiles[JOKER_GFX_TILES_LEN];  \
+    extern const unsigned short joker_gfx##idx##Pal[16];
+#include <def_joker_gfx_table.h>
+#undef DEF_JOKER_GFX
+// clang-format on
+
+#endif // AI_TOURNAMENT_JOKER_GFX_H
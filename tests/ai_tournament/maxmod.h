@@ -0,0 +1,7 @@
+// Host stand-in for maxmod, see tonc.h
+#ifndef AI_TOURNAMENT_MAXMOD_H
+#define AI_TOURNAMENT_MAXMOD_H
+
+typedef unsigned int mm_word;
+
+#endif // AI_TOURNAMENT_MAXMOD_H
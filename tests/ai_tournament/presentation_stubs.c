@@ -0,0 +1,86 @@
+/*
+ * Host stand-ins for the sprites, graphics and displays the jokers and the cards draw to. Nothing
+ * in here does anything: the tournament only keeps the score, see tonc.h.
+ */
+#include "deck_gfx.h"
+#include "joker_gfx.h"
+
+#include <card.h>
+#include <game.h>
+#include <joker.h>
+#include <sprite.h>
+
+CHARBLOCK tile_mem[6];
+COLOR pal_obj_mem[256];
+
+#define DEF_JOKER_GFX(idx)                                     \
+    const unsigned int joker_gfx##idx##Tiles[JOKER_GFX_TILES_LEN]; \
+    const unsigned short joker_gfx##idx##Pal[16];
+#include <def_joker_gfx_table.h>
+#undef DEF_JOKER_GFX
+
+const unsigned int deck_gfxTiles[1];
+const unsigned short deck_gfxPal[16];
+
+// Every sprite object is this one, its position stays at 0
+static SpriteObject sprite_object;
+
+bool get_modded_joker_gfx(int joker_id, const unsigned int** out_tiles, const unsigned short** out_pal)
+{
+    return false;
+}
+
+Sprite* sprite_new(u16 a0, u16 a1, u32 tid, u32 pb, int sprite_index)
+{
+    return NULL;
+}
+
+// No sprite is ever made, so every joker sits on the first joker layer and palette
+int sprite_get_layer(Sprite* sprite)
+{
+    return JOKER_STARTING_LAYER;
+}
+
+int sprite_get_pb(const Sprite* sprite)
+{
+    return JOKER_BASE_PB;
+}
+
+SpriteObject* sprite_object_new()
+{
+    return &sprite_object;
+}
+
+void sprite_object_destroy(SpriteObject** sprite_object)
+{
+    *sprite_object = NULL;
+}
+
+void sprite_object_set_sprite(SpriteObject* sprite_object, Sprite* sprite)
+{
+}
+
+void sprite_object_update(SpriteObject* sprite_object)
+{
+}
+
+void sprite_object_shake(SpriteObject* sprite_object, mm_word sound_id)
+{
+}
+
+Sprite* sprite_object_get_sprite(SpriteObject* sprite_object)
+{
+    return NULL;
+}
+
+void display_chips()
+{
+}
+
+void display_mult()
+{
+}
+
+void display_money()
+{
+}
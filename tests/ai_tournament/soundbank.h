@@ -0,0 +1,12 @@
+// Host stand-in for the sound IDs mmutil generates in the GBA build, see tonc.h
+#ifndef AI_TOURNAMENT_SOUNDBANK_H
+#define AI_TOURNAMENT_SOUNDBANK_H
+
+enum
+{
+    SFX_CHIPS_GENERIC,
+    SFX_MULT,
+    SFX_XMULT,
+};
+
+#endif // AI_TOURNAMENT_SOUNDBANK_H
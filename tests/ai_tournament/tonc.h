@@ -0,0 +1,130 @@
+/*
+ * Host stand-in for the parts of libtonc the AI, the jokers and the cards use, so they can be
+ * built without devkitARM. Nothing in here does anything.
+ */
+#ifndef AI_TOURNAMENT_TONC_H
+#define AI_TOURNAMENT_TONC_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+typedef uint8_t u8;
+typedef uint16_t u16;
+typedef uint32_t u32;
+typedef uint64_t u64;
+typedef int8_t s8;
+typedef int16_t s16;
+typedef int32_t s32;
+typedef int64_t s64;
+typedef unsigned int uint;
+typedef s32 FIXED;
+typedef u16 COLOR;
+
+typedef struct
+{
+    u16 attr0, attr1, attr2;
+    s16 fill;
+} OBJ_ATTR;
+
+typedef struct
+{
+    u16 fill0[3];
+    s16 pa;
+    u16 fill1[3];
+    s16 pb;
+    u16 fill2[3];
+    s16 pc;
+    u16 fill3[3];
+    s16 pd;
+} OBJ_AFFINE;
+
+typedef struct
+{
+    u32 data[8];
+} TILE;
+
+typedef TILE CHARBLOCK[512];
+
+typedef struct
+{
+    int x, y;
+} POINT;
+
+typedef struct
+{
+    int left, top, right, bottom;
+} RECT;
+
+typedef struct
+{
+    int x, y;
+} BG_POINT;
+
+#define INLINE    static inline
+#define EWRAM_BSS
+
+#define max(a, b) (((a) > (b)) ? (a) : (b))
+#define min(a, b) (((a) < (b)) ? (a) : (b))
+
+#define FIX_SHIFT  8
+#define fx2int(fx) ((fx) >> FIX_SHIFT)
+
+#define ATTR0_SQUARE  0
+#define ATTR0_4BPP    0
+#define ATTR0_AFF     0x0100
+#define ATTR1_SIZE_32 0x8000
+
+// Video memory the sprite graphics are copied to, defined in presentation_stubs.c
+extern CHARBLOCK tile_mem[6];
+extern COLOR pal_obj_mem[256];
+
+#define GRIT_CPY(dst, name) ((void)(dst), (void)(name))
+
+// The timers never tick on the host, so the AI's cycle budgets never run out
+extern volatile u16 REG_TM2D, REG_TM2CNT, REG_TM3D, REG_TM3CNT;
+
+#define TM_FREQ_1  0
+#define TM_CASCADE 0x0004
+#define TM_ENABLE  0x0080
+
+static inline void obj_set_pos(OBJ_ATTR* obj, int x, int y)
+{
+    (void)obj;
+    (void)x;
+    (void)y;
+}
+
+static inline void memcpy16(void* dst, const void* src, uint hwcount)
+{
+    (void)dst;
+    (void)src;
+    (void)hwcount;
+}
+
+static inline void memcpy32(void* dst, const void* src, uint wcount)
+{
+    (void)dst;
+    (void)src;
+    (void)wcount;
+}
+
+static inline void tte_set_pos(int x, int y)
+{
+    (void)x;
+    (void)y;
+}
+
+static inline void tte_set_special(u32 special)
+{
+    (void)special;
+}
+
+static inline int tte_write(const char* text)
+{
+    (void)text;
+    return 0;
+}
+
+#endif // AI_TOURNAMENT_TONC_H
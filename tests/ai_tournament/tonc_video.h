@@ -0,0 +1,2 @@
+// Host stand-in for tonc_video.h, see tonc.h
+#include <tonc.h>
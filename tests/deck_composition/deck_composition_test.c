@@ -0,0 +1,168 @@
+#include <card_types.h>
+#include <deck_composition.h>
+#include <assert.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#define NUM_RANDOM_OPERATIONS 200000
+#define MAX_PILE_SIZE         104 // Two regular decks, so every card can be duplicated
+
+// Reference answers computed by scanning the pile
+static void check_against_pile(const DeckComposition* comp, Card* const* pile, int size)
+{
+    uint8_t card_counts[NUM_SUITS][NUM_RANKS] = {0};
+    for (int i = 0; i < size; i++)
+        card_counts[pile[i]->suit][pile[i]->rank]++;
+
+    uint16_t rank_mask = 0;
+    for (int suit = 0; suit < NUM_SUITS; suit++)
+    {
+        uint16_t suit_ranks = 0;
+        int suit_count = 0;
+        for (int rank = 0; rank < NUM_RANKS; rank++)
+        {
+            assert(deck_comp_card_count(comp, suit, rank) == card_counts[suit][rank]);
+            if (card_counts[suit][rank] > 0)
+                suit_ranks |= 1 << rank;
+            suit_count += card_counts[suit][rank];
+        }
+        assert(comp->suit_ranks[suit] == suit_ranks);
+        assert(deck_comp_suit_count(comp, suit) == suit_count);
+        rank_mask |= suit_ranks;
+    }
+
+    for (int rank = 0; rank < NUM_RANKS; rank++)
+    {
+        int rank_count = 0;
+        for (int suit = 0; suit < NUM_SUITS; suit++)
+            rank_count += card_counts[suit][rank];
+        assert(deck_comp_rank_count(comp, rank) == rank_count);
+    }
+
+    assert(deck_comp_rank_mask(comp) == rank_mask);
+    assert(comp->size == size);
+}
+
+void test_empty()
+{
+    DeckComposition comp;
+    deck_comp_clear(&comp);
+    assert(comp.size == 0);
+    assert(deck_comp_rank_mask(&comp) == 0);
+    for (int suit = 0; suit < NUM_SUITS; suit++)
+        assert(deck_comp_suit_count(&comp, suit) == 0);
+}
+
+void test_remove_missing_card_is_ignored()
+{
+    Card ace = {SPADES, ACE};
+    Card king = {SPADES, KING};
+
+    DeckComposition comp;
+    deck_comp_clear(&comp);
+    deck_comp_add(&comp, &king);
+    deck_comp_remove(&comp, &ace);
+
+    assert(comp.size == 1);
+    assert(deck_comp_suit_count(&comp, SPADES) == 1);
+    assert(deck_comp_rank_count(&comp, ACE) == 0);
+    assert(deck_comp_rank_mask(&comp) == 1 << KING);
+}
+
+void test_duplicates_keep_rank_bit()
+{
+    Card two = {HEARTS, TWO};
+
+    DeckComposition comp;
+    deck_comp_clear(&comp);
+    deck_comp_add(&comp, &two);
+    deck_comp_add(&comp, &two);
+
+    // The rank bit must survive until the last copy is gone
+    deck_comp_remove(&comp, &two);
+    assert(comp.suit_ranks[HEARTS] == 1 << TWO);
+    assert(deck_comp_card_count(&comp, HEARTS, TWO) == 1);
+
+    deck_comp_remove(&comp, &two);
+    assert(comp.suit_ranks[HEARTS] == 0);
+    assert(comp.size == 0);
+}
+
+void test_from_cards_skips_null()
+{
+    Card cards[] = {{DIAMONDS, TEN}, {CLUBS, TEN}};
+    Card* pile[] = {&cards[0], NULL, &cards[1]};
+
+    DeckComposition comp;
+    deck_comp_from_cards(&comp, pile, 3);
+    assert(comp.size == 2);
+    assert(deck_comp_rank_count(&comp, TEN) == 2);
+    assert(deck_comp_rank_mask(&comp) == 1 << TEN);
+}
+
+// Random pushes and pops, the way the game moves cards in and out of its deck
+void test_random_push_pop()
+{
+    Card cards[NUM_SUITS * NUM_RANKS];
+    for (int suit = 0; suit < NUM_SUITS; suit++)
+    {
+        for (int rank = 0; rank < NUM_RANKS; rank++)
+            cards[suit * NUM_RANKS + rank] = (Card){suit, rank};
+    }
+
+    Card* pile[MAX_PILE_SIZE];
+    int size = 0;
+
+    DeckComposition comp;
+    deck_comp_clear(&comp);
+
+    srand(1234);
+    for (int i = 0; i < NUM_RANDOM_OPERATIONS; i++)
+    {
+        bool push = size == 0 || (size < MAX_PILE_SIZE && rand() % 2);
+        if (push)
+        {
+            Card* card = &cards[rand() % (NUM_SUITS * NUM_RANKS)];
+            pile[size++] = card;
+            deck_comp_add(&comp, card);
+        }
+        else
+        {
+            // Pop any card, not only the top one, as destroying a card would
+            int idx = rand() % size;
+            Card* card = pile[idx];
+            pile[idx] = pile[--size];
+            deck_comp_remove(&comp, card);
+        }
+
+        if (i % 64 == 0)
+            check_against_pile(&comp, pile, size);
+    }
+
+    DeckComposition rebuilt;
+    deck_comp_from_cards(&rebuilt, pile, size);
+    check_against_pile(&rebuilt, pile, size);
+    check_against_pile(&comp, pile, size);
+}
+
+int main()
+{
+    printf("Testing Deck Composition Empty.\n");
+    test_empty();
+    printf("Testing Deck Composition Remove Missing Card.\n");
+    test_remove_missing_card_is_ignored();
+    printf("Testing Deck Composition Duplicate Cards.\n");
+    test_duplicates_keep_rank_bit();
+    printf("Testing Deck Composition From Cards.\n");
+    test_from_cards_skips_null();
+    printf("Testing Deck Composition Random Push and Pop.\n");
+    test_random_push_pop();
+
+    printf("-------------------------------------------------------------------------------\n");
+    printf("Deck Composition Tests Passed :)\n");
+    printf("-------------------------------------------------------------------------------\n");
+
+    return 0;
+}
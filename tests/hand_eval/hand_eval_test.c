@@ -0,0 +1,586 @@
+#include <card_types.h>
+#include <hand_eval.h>
+#include <hand_memo.h>
+#include <util.h>
+#include <assert.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+#define DECK_SIZE      (NUM_SUITS * NUM_RANKS)
+#define MAX_COMBO_SIZE 5
+#define NUM_RULE_SETS  32
+
+static Card deck[DECK_SIZE];
+static RuleSet rule_sets[NUM_RULE_SETS];
+
+/*
+ * Brute-force reference, written the straightforward way on plain count arrays
+ * so it shares nothing with the bitboard/lookup table implementation.
+ */
+typedef struct
+{
+    int ranks[NUM_RANKS];
+    int suits[NUM_SUITS];
+} Distribution;
+
+static Distribution ref_distribution(Card** cards, int count)
+{
+    Distribution dist;
+    memset(&dist, 0, sizeof(dist));
+    for (int i = 0; i < count; i++)
+    {
+        if (cards[i])
+        {
+            dist.ranks[cards[i]->rank]++;
+            dist.suits[cards[i]->suit]++;
+        }
+    }
+    return dist;
+}
+
+// Rank at a position of the straight search. Without wrapping, position -1 is the low Ace.
+static bool ref_rank_present(const Distribution* dist, int pos, bool wrap)
+{
+    if (wrap)
+        return dist->ranks[(pos + NUM_RANKS) % NUM_RANKS] > 0;
+    if (pos == -1)
+        return dist->ranks[ACE] > 0;
+    return pos >= 0 && pos < NUM_RANKS && dist->ranks[pos] > 0;
+}
+
+// Depth-first search for a chain of `needed` more cards starting after `pos`
+static bool ref_extend_straight(const Distribution* dist, int pos, int needed, const RuleSet* rules)
+{
+    if (needed == 0)
+        return true;
+
+    int max_step = rules->shortcut ? 2 : 1;
+    for (int step = 1; step <= max_step; step++)
+    {
+        int next = pos + step;
+        if (!rules->mobius_wrap && next >= NUM_RANKS)
+            break;
+        if (ref_rank_present(dist, next, rules->mobius_wrap) &&
+            ref_extend_straight(dist, next, needed - 1, rules))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+// The joker 60 streak rule is only defined by its loop, so the reference is the loop itself
+static bool ref_legacy_wrap_straight(const Distribution* dist, const RuleSet* rules)
+{
+    int min_len = rules->straight_size;
+    int streak = 0;
+    int gaps = 0;
+
+    for (int i = 0; i < NUM_RANKS + min_len - 1; i++)
+    {
+        if (dist->ranks[i % NUM_RANKS] > 0)
+        {
+            streak++;
+            gaps = 0;
+            if (streak >= min_len)
+                return true;
+        }
+        else if (rules->shortcut && gaps < 1 && streak > 0)
+        {
+            streak++;
+            gaps++;
+            if (streak >= min_len)
+                return true;
+        }
+        else
+        {
+            streak = 0;
+            gaps = 0;
+        }
+    }
+    return false;
+}
+
+static bool ref_straight(const Distribution* dist, const RuleSet* rules)
+{
+    int first_pos = rules->mobius_wrap ? 0 : -1;
+    for (int pos = first_pos; pos < NUM_RANKS; pos++)
+    {
+        if (ref_rank_present(dist, pos, rules->mobius_wrap) &&
+            ref_extend_straight(dist, pos, rules->straight_size - 1, rules))
+        {
+            return true;
+        }
+    }
+    return rules->legacy_wrap && ref_legacy_wrap_straight(dist, rules);
+}
+
+static bool ref_flush(const Distribution* dist, const RuleSet* rules)
+{
+    for (int suit = 0; suit < NUM_SUITS; suit++)
+    {
+        if (dist->suits[suit] >= rules->straight_size)
+            return true;
+    }
+
+    if (rules->smeared)
+    {
+        int red = dist->suits[HEARTS] + dist->suits[DIAMONDS];
+        int black = dist->suits[SPADES] + dist->suits[CLUBS];
+        return red >= rules->straight_size || black >= rules->straight_size;
+    }
+    return false;
+}
+
+static ContainedHandTypes ref_contained_types(Card** cards, int count, const RuleSet* rules)
+{
+    ContainedHandTypes hand_types = {0};
+    Distribution dist = ref_distribution(cards, count);
+
+    int highest_n = 0;
+    int num_pairs = 0;
+    int num_threes = 0;
+    bool royal_ranks = true;
+    for (int rank = 0; rank < NUM_RANKS; rank++)
+    {
+        if (dist.ranks[rank] > highest_n)
+            highest_n = dist.ranks[rank];
+        if (dist.ranks[rank] >= 2)
+            num_pairs++;
+        if (dist.ranks[rank] >= 3)
+            num_threes++;
+        if (rank >= TEN && dist.ranks[rank] == 0)
+            royal_ranks = false;
+    }
+
+    if (highest_n == 0)
+        return hand_types;
+
+    hand_types.HIGH_CARD = 1;
+    hand_types.PAIR = highest_n >= 2;
+    hand_types.TWO_PAIR = num_pairs >= 2;
+    hand_types.THREE_OF_A_KIND = highest_n >= 3;
+    hand_types.STRAIGHT = ref_straight(&dist, rules);
+    hand_types.FLUSH = ref_flush(&dist, rules);
+    hand_types.FULL_HOUSE = num_threes >= 1 && num_pairs >= 2;
+    hand_types.FOUR_OF_A_KIND = highest_n >= 4;
+    hand_types.STRAIGHT_FLUSH = hand_types.STRAIGHT && hand_types.FLUSH;
+    hand_types.ROYAL_FLUSH = hand_types.STRAIGHT_FLUSH && royal_ranks;
+    hand_types.FIVE_OF_A_KIND = highest_n >= 5;
+    hand_types.FLUSH_HOUSE = hand_types.FLUSH && hand_types.FULL_HOUSE;
+    hand_types.FLUSH_FIVE = hand_types.FLUSH && hand_types.FIVE_OF_A_KIND;
+
+    return hand_types;
+}
+
+static enum HandType ref_highest_type(ContainedHandTypes contained_types)
+{
+    for (enum HandType hand_type = FLUSH_FIVE; hand_type > NONE; hand_type--)
+    {
+        if ((contained_types.value >> (hand_type - 1)) & 0x1)
+            return hand_type;
+    }
+    return NONE;
+}
+
+static void init_test_data(void)
+{
+    for (int suit = 0; suit < NUM_SUITS; suit++)
+    {
+        for (int rank = 0; rank < NUM_RANKS; rank++)
+        {
+            deck[suit * NUM_RANKS + rank] = (Card){.suit = suit, .rank = rank};
+        }
+    }
+
+    for (int i = 0; i < NUM_RULE_SETS; i++)
+    {
+        rule_sets[i] = (RuleSet){
+            .straight_size = (i & 0x1) ? STRAIGHT_AND_FLUSH_SIZE_FOUR_FINGERS
+                                       : STRAIGHT_AND_FLUSH_SIZE_DEFAULT,
+            .shortcut = (i & 0x2) != 0,
+            .smeared = (i & 0x4) != 0,
+            .mobius_wrap = (i & 0x8) != 0,
+            .legacy_wrap = (i & 0x10) != 0,
+        };
+    }
+}
+
+// The hand class table must agree with the evaluator whenever no joker bends the rules
+static void check_vanilla_hand(Card** cards, int count)
+{
+    const RuleSet* vanilla = &rule_sets[0];
+    HandBitboard bb;
+    hand_bitboard_from_cards(&bb, cards, count);
+
+    enum HandType hand_type = hand_eval_highest_type(hand_eval_contained_types(&bb, vanilla));
+    assert(hand_eval_vanilla_type(&bb) == hand_type);
+    assert(
+        hand_eval_vanilla_scoring_mask(&bb, cards, count) ==
+        hand_eval_scoring_mask(&bb, cards, count, hand_type, vanilla)
+    );
+}
+
+static void check_hand(Card** cards, int count)
+{
+    for (int i = 0; i < NUM_RULE_SETS; i++)
+    {
+        ContainedHandTypes expected = ref_contained_types(cards, count, &rule_sets[i]);
+        ContainedHandTypes actual = hand_eval_cards(cards, count, &rule_sets[i]);
+
+        if (expected.value != actual.value)
+        {
+            printf("Mismatch for rule set %d:", i);
+            for (int c = 0; c < count; c++)
+                printf(" (suit %d, rank %d)", cards[c]->suit, cards[c]->rank);
+            printf(" expected 0x%04X got 0x%04X\n", expected.value, actual.value);
+        }
+        assert(expected.value == actual.value);
+        assert(ref_highest_type(expected) == hand_eval_highest_type(actual));
+    }
+
+    check_vanilla_hand(cards, count);
+}
+
+// Checks every combination of `size` cards from the deck, returns how many were checked
+static int check_all_combinations(int size)
+{
+    int idx[MAX_COMBO_SIZE];
+    Card* cards[MAX_COMBO_SIZE];
+    int num_checked = 0;
+
+    for (int i = 0; i < size; i++)
+        idx[i] = i;
+
+    while (true)
+    {
+        for (int i = 0; i < size; i++)
+            cards[i] = &deck[idx[i]];
+        check_hand(cards, size);
+        num_checked++;
+
+        // Advance to the next combination in lexicographic order
+        int i = size - 1;
+        while (i >= 0 && idx[i] == DECK_SIZE - size + i)
+            i--;
+        if (i < 0)
+            break;
+        idx[i]++;
+        for (int j = i + 1; j < size; j++)
+            idx[j] = idx[j - 1] + 1;
+    }
+
+    return num_checked;
+}
+
+void test_small_hands()
+{
+    // C(52,1) + C(52,2) + C(52,3) + C(52,4), small enough to cover exhaustively
+    assert(check_all_combinations(1) == 52);
+    assert(check_all_combinations(2) == 1326);
+    assert(check_all_combinations(3) == 22100);
+    assert(check_all_combinations(4) == 270725);
+}
+
+void test_five_card_hands()
+{
+    assert(check_all_combinations(5) == 2598960);
+}
+
+void test_empty_and_null_cards()
+{
+    Card* cards[MAX_COMBO_SIZE] = {NULL};
+    RuleSet rules = rule_sets[0];
+
+    assert(hand_eval_cards(cards, 0, &rules).value == 0);
+    assert(hand_eval_cards(cards, MAX_COMBO_SIZE, &rules).value == 0);
+    assert(hand_eval_highest_type(hand_eval_cards(cards, 0, &rules)) == NONE);
+
+    // NULL entries are skipped
+    cards[1] = &deck[ACE];
+    cards[3] = &deck[NUM_RANKS + ACE];
+    assert(hand_eval_highest_type(hand_eval_cards(cards, MAX_COMBO_SIZE, &rules)) == PAIR);
+}
+
+static bool bitboards_equal(const HandBitboard* a, const HandBitboard* b)
+{
+    return memcmp(a->suit_ranks, b->suit_ranks, sizeof(a->suit_ranks)) == 0 &&
+           a->rank_mask == b->rank_mask && a->suit_counts == b->suit_counts &&
+           a->rank_counts == b->rank_counts;
+}
+
+void test_bitboard_add_remove()
+{
+    // A full house plus a kicker, removed one card at a time in selection order
+    Card* cards[] = {
+        &deck[HEARTS * NUM_RANKS + KING],
+        &deck[SPADES * NUM_RANKS + KING],
+        &deck[CLUBS * NUM_RANKS + KING],
+        &deck[HEARTS * NUM_RANKS + FOUR],
+        &deck[DIAMONDS * NUM_RANKS + FOUR],
+    };
+    int num_cards = NUM_ELEM_IN_ARR(cards);
+
+    HandBitboard live;
+    hand_bitboard_clear(&live);
+    for (int i = 0; i < num_cards; i++)
+        hand_bitboard_add_card(&live, cards[i]);
+
+    for (int removed = 0; removed < num_cards; removed++)
+    {
+        HandBitboard rebuilt;
+        hand_bitboard_from_cards(&rebuilt, &cards[removed], num_cards - removed);
+        assert(bitboards_equal(&live, &rebuilt));
+        hand_bitboard_remove_card(&live, cards[removed]);
+    }
+
+    HandBitboard empty;
+    hand_bitboard_clear(&empty);
+    assert(bitboards_equal(&live, &empty));
+
+    // Merging two halves gives the bitboard of the whole set
+    HandBitboard merged;
+    HandBitboard second_half;
+    hand_bitboard_from_cards(&merged, cards, 2);
+    hand_bitboard_from_cards(&second_half, &cards[2], num_cards - 2);
+    hand_bitboard_merge(&merged, &second_half);
+    hand_bitboard_from_cards(&live, cards, num_cards);
+    assert(bitboards_equal(&merged, &live));
+}
+
+void test_variant_selection()
+{
+    HandEvalFunc variants[HAND_EVAL_NUM_VARIANTS] = {NULL};
+
+    for (int i = 0; i < NUM_RULE_SETS; i++)
+    {
+        const RuleSet* rules = &rule_sets[i];
+        HandEvalFunc hand_eval = hand_eval_select_variant(rules);
+        assert(hand_eval != NULL);
+
+        // The legacy wrap rule is read at runtime so it shares the variant of its other rules
+        int idx = HAND_EVAL_VARIANT_IDX(
+            rules->straight_size == STRAIGHT_AND_FLUSH_SIZE_FOUR_FINGERS,
+            rules->shortcut,
+            rules->smeared,
+            rules->mobius_wrap
+        );
+        assert(variants[idx] == NULL || variants[idx] == hand_eval);
+        variants[idx] = hand_eval;
+    }
+
+    // Every combination gets its own specialized evaluator
+    for (int i = 0; i < HAND_EVAL_NUM_VARIANTS; i++)
+    {
+        for (int j = i + 1; j < HAND_EVAL_NUM_VARIANTS; j++)
+            assert(variants[i] != variants[j]);
+    }
+}
+
+void test_known_hands()
+{
+    RuleSet vanilla = rule_sets[0];
+    RuleSet four_fingers = rule_sets[1];
+
+    // A2345 of mixed suits is the ace-low straight
+    Card* wheel[] = {
+        &deck[DIAMONDS * NUM_RANKS + ACE],
+        &deck[CLUBS * NUM_RANKS + TWO],
+        &deck[HEARTS * NUM_RANKS + THREE],
+        &deck[SPADES * NUM_RANKS + FOUR],
+        &deck[DIAMONDS * NUM_RANKS + FIVE],
+    };
+    assert(hand_eval_highest_type(hand_eval_cards(wheel, 5, &vanilla)) == STRAIGHT);
+
+    // TJQKA of hearts
+    Card* royal[] = {
+        &deck[HEARTS * NUM_RANKS + TEN],
+        &deck[HEARTS * NUM_RANKS + JACK],
+        &deck[HEARTS * NUM_RANKS + QUEEN],
+        &deck[HEARTS * NUM_RANKS + KING],
+        &deck[HEARTS * NUM_RANKS + ACE],
+    };
+    assert(hand_eval_highest_type(hand_eval_cards(royal, 5, &vanilla)) == ROYAL_FLUSH);
+
+    // Four spades are only a flush with Four Fingers
+    Card* four_spades[] = {
+        &deck[SPADES * NUM_RANKS + TWO],
+        &deck[SPADES * NUM_RANKS + SEVEN],
+        &deck[SPADES * NUM_RANKS + NINE],
+        &deck[SPADES * NUM_RANKS + KING],
+    };
+    assert(hand_eval_highest_type(hand_eval_cards(four_spades, 4, &vanilla)) == HIGH_CARD);
+    assert(hand_eval_highest_type(hand_eval_cards(four_spades, 4, &four_fingers)) == FLUSH);
+}
+
+static uint8_t scoring_mask_of(Card** cards, int count, const RuleSet* rules)
+{
+    HandBitboard bb;
+    hand_bitboard_from_cards(&bb, cards, count);
+    enum HandType hand_type = hand_eval_highest_type(hand_eval_contained_types(&bb, rules));
+    return hand_eval_scoring_mask(&bb, cards, count, hand_type, rules);
+}
+
+void test_scoring_mask()
+{
+    RuleSet vanilla = rule_sets[0];
+    RuleSet four_fingers = rule_sets[1];
+    RuleSet smeared = rule_sets[4];
+
+    assert(rule_set_is_vanilla(&vanilla));
+    assert(!rule_set_is_vanilla(&four_fingers) && !rule_set_is_vanilla(&smeared));
+
+    // Only the first of the highest cards scores
+    Card* high_card[] = {
+        &deck[HEARTS * NUM_RANKS + FOUR],
+        &deck[SPADES * NUM_RANKS + KING],
+        &deck[CLUBS * NUM_RANKS + NINE],
+        &deck[DIAMONDS * NUM_RANKS + TWO],
+    };
+    assert(scoring_mask_of(high_card, 4, &vanilla) == 0x02);
+
+    Card* two_pair[] = {
+        &deck[HEARTS * NUM_RANKS + FOUR],
+        &deck[SPADES * NUM_RANKS + KING],
+        &deck[CLUBS * NUM_RANKS + SEVEN],
+        &deck[DIAMONDS * NUM_RANKS + FOUR],
+        &deck[HEARTS * NUM_RANKS + KING],
+    };
+    assert(scoring_mask_of(two_pair, 5, &vanilla) == 0x1B);
+
+    // AA234: with Four Fingers the paired ace scores along with the straight
+    Card* paired_straight[] = {
+        &deck[HEARTS * NUM_RANKS + ACE],
+        &deck[SPADES * NUM_RANKS + ACE],
+        &deck[CLUBS * NUM_RANKS + TWO],
+        &deck[DIAMONDS * NUM_RANKS + THREE],
+        &deck[HEARTS * NUM_RANKS + FOUR],
+    };
+    assert(scoring_mask_of(paired_straight, 5, &vanilla) == 0x03);
+    assert(scoring_mask_of(paired_straight, 5, &four_fingers) == 0x1F);
+
+    // Four spades and an off-suit kicker
+    Card* four_flush[] = {
+        &deck[SPADES * NUM_RANKS + TWO],
+        &deck[HEARTS * NUM_RANKS + SEVEN],
+        &deck[SPADES * NUM_RANKS + SEVEN],
+        &deck[SPADES * NUM_RANKS + NINE],
+        &deck[SPADES * NUM_RANKS + KING],
+    };
+    assert(scoring_mask_of(four_flush, 5, &four_fingers) == 0x1D);
+
+    // Hearts and diamonds are a single flush with the Smeared Joker
+    Card* smeared_flush[] = {
+        &deck[HEARTS * NUM_RANKS + TWO],
+        &deck[DIAMONDS * NUM_RANKS + FIVE],
+        &deck[HEARTS * NUM_RANKS + SEVEN],
+        &deck[DIAMONDS * NUM_RANKS + NINE],
+        &deck[HEARTS * NUM_RANKS + KING],
+    };
+    assert(scoring_mask_of(smeared_flush, 5, &vanilla) == 0x10);
+    assert(scoring_mask_of(smeared_flush, 5, &smeared) == 0x1F);
+
+    // Duplicated cards make five of a kind and flush five possible
+    Card* flush_five[] = {
+        &deck[CLUBS * NUM_RANKS + SIX],
+        &deck[CLUBS * NUM_RANKS + SIX],
+        &deck[CLUBS * NUM_RANKS + SIX],
+        &deck[CLUBS * NUM_RANKS + SIX],
+        &deck[CLUBS * NUM_RANKS + SIX],
+    };
+    check_hand(flush_five, 5);
+    check_hand(flush_five, 4);
+    assert(scoring_mask_of(flush_five, 5, &vanilla) == 0x1F);
+
+    // NULL entries never score
+    Card* cards[MAX_COMBO_SIZE] = {NULL};
+    cards[2] = &deck[ACE];
+    assert(scoring_mask_of(cards, MAX_COMBO_SIZE, &vanilla) == 0x04);
+}
+
+void test_hand_memo()
+{
+    hand_memo_clear();
+    hand_memo_reset_stats();
+    const HandMemoStats* stats = hand_memo_get_stats();
+
+    Card* cards[] = {
+        &deck[HEARTS * NUM_RANKS + KING],
+        &deck[SPADES * NUM_RANKS + KING],
+        &deck[CLUBS * NUM_RANKS + FOUR],
+    };
+    HandBitboard bb;
+    hand_bitboard_from_cards(&bb, cards, 3);
+
+    // The same cards under the same rules hit, other rules miss
+    for (int i = 0; i < NUM_RULE_SETS; i++)
+    {
+        const RuleSet* rules = &rule_sets[i];
+        HandEvalFunc hand_eval = hand_eval_select_variant(rules);
+        ContainedHandTypes expected = hand_eval(&bb, rules);
+
+        for (int pass = 0; pass < 2; pass++)
+        {
+            enum HandType hand_type = NONE;
+            assert(hand_memo_eval(&bb, rules, hand_eval, &hand_type).value == expected.value);
+            assert(hand_type == PAIR);
+        }
+    }
+    assert(stats->misses == NUM_RULE_SETS);
+    assert(stats->hits == NUM_RULE_SETS);
+
+    // Duplicated cards are never cached since the key can't tell them apart
+    Card* duplicates[] = {cards[0], cards[0]};
+    hand_bitboard_from_cards(&bb, duplicates, 2);
+    hand_memo_reset_stats();
+    for (int pass = 0; pass < 2; pass++)
+    {
+        enum HandType hand_type = NONE;
+        hand_memo_eval(&bb, &rule_sets[0], hand_eval_select_variant(&rule_sets[0]), &hand_type);
+        assert(hand_type == PAIR);
+    }
+    assert(stats->hits == 0 && stats->misses == 2);
+
+    // Colliding entries are replaced, results must stay right whatever the cache holds
+    for (int a = 0; a < DECK_SIZE; a++)
+    {
+        for (int b = a + 1; b < DECK_SIZE; b++)
+        {
+            Card* pair[] = {&deck[a], &deck[b]};
+            const RuleSet* rules = &rule_sets[(a + b) % NUM_RULE_SETS];
+            HandEvalFunc hand_eval = hand_eval_select_variant(rules);
+
+            hand_bitboard_from_cards(&bb, pair, 2);
+            ContainedHandTypes expected = hand_eval(&bb, rules);
+            assert(hand_memo_eval(&bb, rules, hand_eval, NULL).value == expected.value);
+        }
+    }
+}
+
+int main()
+{
+    init_test_data();
+    printf("Testing Hand Eval Empty and Null Cards.\n");
+    test_empty_and_null_cards();
+    printf("Testing Hand Eval Bitboard Add and Remove.\n");
+    test_bitboard_add_remove();
+    printf("Testing Hand Eval Variant Selection.\n");
+    test_variant_selection();
+    printf("Testing Hand Eval Known Hands.\n");
+    test_known_hands();
+    printf("Testing Hand Eval Scoring Mask.\n");
+    test_scoring_mask();
+    printf("Testing Hand Eval Memo.\n");
+    test_hand_memo();
+    printf("Testing Hand Eval Small Hands.\n");
+    test_small_hands();
+    printf("Testing Hand Eval Five Card Hands.\n");
+    test_five_card_hands();
+
+    printf("-------------------------------------------------------------------------------\n");
+    printf("Hand Eval Tests Passed :)\n");
+    printf("-------------------------------------------------------------------------------\n");
+
+    return 0;
+}
@@ -0,0 +1,155 @@
+#include <card_types.h>
+#include <rank_histogram.h>
+#include <assert.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#define NUM_RANDOM_HISTOGRAMS 200000
+
+// Reference answers computed on the plain per-rank counts
+static void check_against_counts(const uint8_t* counts)
+{
+    RankHistogram hist = rank_hist_from_u8(counts);
+
+    uint8_t unpacked[NUM_RANKS];
+    rank_hist_to_u8(hist, unpacked);
+
+    uint8_t max_count = 0;
+    for (int rank = 0; rank < NUM_RANKS; rank++)
+    {
+        assert(unpacked[rank] == counts[rank]);
+        assert(rank_hist_count(hist, rank) == counts[rank]);
+        if (counts[rank] > max_count)
+            max_count = counts[rank];
+    }
+    assert(rank_hist_max_count(hist) == max_count);
+
+    for (int n = 1; n <= RANK_HISTOGRAM_MAX_COUNT + 1; n++)
+    {
+        uint16_t rank_mask = 0;
+        int num_ranks = 0;
+        for (int rank = 0; rank < NUM_RANKS; rank++)
+        {
+            if (counts[rank] >= n)
+            {
+                rank_mask |= 1 << rank;
+                num_ranks++;
+            }
+        }
+
+        assert(rank_hist_ranks_at_least(hist, n) == rank_mask);
+        assert(rank_hist_num_at_least(hist, n) == num_ranks);
+        assert(rank_hist_any_at_least(hist, n) == (num_ranks > 0));
+        if (n == 2)
+            assert(rank_hist_pairs_count(hist) == num_ranks);
+    }
+}
+
+void test_empty()
+{
+    RankHistogram hist = 0;
+    assert(rank_hist_max_count(hist) == 0);
+    assert(rank_hist_pairs_count(hist) == 0);
+    assert(!rank_hist_any_at_least(hist, 1));
+    assert(rank_hist_ranks_at_least(hist, 1) == 0);
+}
+
+void test_add_remove_saturates()
+{
+    RankHistogram hist = 0;
+
+    for (int i = 0; i < RANK_HISTOGRAM_MAX_COUNT + 3; i++)
+        rank_hist_add(&hist, KING);
+    rank_hist_add(&hist, ACE);
+    rank_hist_add(&hist, TWO);
+
+    // The saturated counter must not spill into the Ace
+    assert(rank_hist_count(hist, KING) == RANK_HISTOGRAM_MAX_COUNT);
+    assert(rank_hist_count(hist, ACE) == 1);
+    assert(rank_hist_count(hist, QUEEN) == 0);
+    assert(rank_hist_max_count(hist) == RANK_HISTOGRAM_MAX_COUNT);
+
+    rank_hist_remove(&hist, TWO);
+    assert(rank_hist_count(hist, TWO) == 0);
+    assert(rank_hist_ranks_at_least(hist, 1) == ((1 << KING) | (1 << ACE)));
+}
+
+void test_from_u8_saturates()
+{
+    uint8_t counts[NUM_RANKS] = {0};
+    counts[FIVE] = 200;
+
+    RankHistogram hist = rank_hist_from_u8(counts);
+    assert(rank_hist_count(hist, FIVE) == RANK_HISTOGRAM_MAX_COUNT);
+    assert(rank_hist_count(hist, SIX) == 0);
+}
+
+void test_merge_saturates()
+{
+    srand(4321);
+    for (int i = 0; i < NUM_RANDOM_HISTOGRAMS; i++)
+    {
+        uint8_t a[NUM_RANKS];
+        uint8_t b[NUM_RANKS];
+        uint8_t expected[NUM_RANKS];
+        for (int rank = 0; rank < NUM_RANKS; rank++)
+        {
+            a[rank] = rand() % (RANK_HISTOGRAM_MAX_COUNT + 1);
+            b[rank] = rand() % (RANK_HISTOGRAM_MAX_COUNT + 1);
+            expected[rank] = a[rank] + b[rank];
+        }
+
+        RankHistogram hist = rank_hist_from_u8(a);
+        rank_hist_merge(&hist, rank_hist_from_u8(b));
+        assert(hist == rank_hist_from_u8(expected));
+    }
+}
+
+void test_single_rank_counts()
+{
+    for (int rank = 0; rank < NUM_RANKS; rank++)
+    {
+        for (int count = 0; count <= RANK_HISTOGRAM_MAX_COUNT; count++)
+        {
+            uint8_t counts[NUM_RANKS] = {0};
+            counts[rank] = count;
+            check_against_counts(counts);
+        }
+    }
+}
+
+void test_random_counts()
+{
+    srand(1234);
+    for (int i = 0; i < NUM_RANDOM_HISTOGRAMS; i++)
+    {
+        uint8_t counts[NUM_RANKS];
+        for (int rank = 0; rank < NUM_RANKS; rank++)
+            counts[rank] = rand() % (RANK_HISTOGRAM_MAX_COUNT + 1);
+        check_against_counts(counts);
+    }
+}
+
+int main()
+{
+    printf("Testing Rank Histogram Empty.\n");
+    test_empty();
+    printf("Testing Rank Histogram Add and Remove Saturation.\n");
+    test_add_remove_saturates();
+    printf("Testing Rank Histogram From Counts Saturation.\n");
+    test_from_u8_saturates();
+    printf("Testing Rank Histogram Merge Saturation.\n");
+    test_merge_saturates();
+    printf("Testing Rank Histogram Single Rank Counts.\n");
+    test_single_rank_counts();
+    printf("Testing Rank Histogram Random Counts.\n");
+    test_random_counts();
+
+    printf("-------------------------------------------------------------------------------\n");
+    printf("Rank Histogram Tests Passed :)\n");
+    printf("-------------------------------------------------------------------------------\n");
+
+    return 0;
+}
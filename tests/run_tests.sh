@@ -20,3 +20,6 @@ run_test bitset
 run_test pool
 run_test list
 run_test util
+run_test hand_eval
+run_test rank_histogram
+run_test deck_composition